@@ -53,16 +53,20 @@ class asio_timer_manager_t final
 				schedule( tcp_connection_ctx_weak_handle_t weak_handle )
 				{
 					m_operation_timer.expires_after( m_check_period );
-					m_operation_timer.async_wait(
-							[ weak_handle = std::move( weak_handle ) ]( const auto & ec ){
-									if( !ec )
-									{
-										if( auto h = weak_handle.lock() )
-										{
-											h->check_timeout( h );
-										}
-									}
-								} );
+					start_waiting( std::move( weak_handle ) );
+				}
+
+				//! Schedule timeouts check invocation at the deadline.
+				/*!
+				 * @since v.0.7.10
+				 */
+				void
+				schedule_at(
+					tcp_connection_ctx_weak_handle_t weak_handle,
+					std::chrono::steady_clock::time_point deadline )
+				{
+					m_operation_timer.expires_at( deadline );
+					start_waiting( std::move( weak_handle ) );
 				}
 
 				//! Cancel timeout guard if any.
@@ -80,6 +84,21 @@ class asio_timer_manager_t final
 			private:
 				asio_ns::steady_timer m_operation_timer;
 				const std::chrono::steady_clock::duration m_check_period;
+
+				void
+				start_waiting( tcp_connection_ctx_weak_handle_t weak_handle )
+				{
+					m_operation_timer.async_wait(
+							[ weak_handle = std::move( weak_handle ) ]( const auto & ec ){
+									if( !ec )
+									{
+										if( auto h = weak_handle.lock() )
+										{
+											h->check_timeout( h );
+										}
+									}
+								} );
+				}
 			//! \}
 		};
 
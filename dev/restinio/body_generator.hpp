@@ -0,0 +1,190 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Pull-based source of a response body.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace restinio
+{
+
+//
+// body_generator_t
+//
+/*!
+ * @brief A source of a response body that is pulled by a connection.
+ *
+ * Data of a generator isn't produced in advance. A connection asks
+ * the generator for the next piece of data when the previous one is
+ * written to the socket. The data is placed by the generator directly
+ * to a buffer of the connection. The buffer is reused for all pieces
+ * of data, so there is no memory allocation for every piece.
+ *
+ * The size of data to be produced has to be known in advance (it's
+ * necessary for `Content-Length` field and for chunked encoding).
+ *
+ * A generator is created by body_generator() function and can be
+ * passed to a response builder as an ordinary writable item.
+ *
+ * @since v.0.7.10
+ */
+class body_generator_t
+{
+	public:
+		//! Interface of a particular generator.
+		class source_t
+		{
+			public:
+				virtual ~source_t() = default;
+
+				//! Fill the buffer with the next piece of data.
+				/*!
+				 * @return the count of bytes placed into the buffer.
+				 */
+				virtual std::size_t
+				next( char * buf, std::size_t capacity ) = 0;
+		};
+
+		body_generator_t(
+			//! Total size of data to be generated.
+			std::size_t size,
+			//! Actual generator.
+			std::unique_ptr< source_t > source )
+			:	m_remaining{ size }
+			,	m_size{ size }
+			,	m_source{ std::move( source ) }
+		{
+			if( !m_source )
+				throw exception_t{ "body generator source is nullptr" };
+		}
+
+		//! Total size of data to be generated.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept { return m_size; }
+
+		//! Size of data that isn't generated yet.
+		[[nodiscard]]
+		std::size_t
+		remaining() const noexcept { return m_remaining; }
+
+		//! Get the next piece of data.
+		/*!
+		 * Not more than remaining() bytes are requested from the source.
+		 *
+		 * @return the count of bytes placed into the buffer. Zero is
+		 * returned only if all data is already generated.
+		 *
+		 * @throw exception_t if the source produces no data before all
+		 * declared data is generated.
+		 */
+		std::size_t
+		next( char * buf, std::size_t capacity )
+		{
+			if( 0u == m_remaining )
+				return 0u;
+
+			const auto requested = std::min( capacity, m_remaining );
+			const auto generated = m_source->next( buf, requested );
+			if( 0u == generated || generated > requested )
+				throw exception_t{ "body generator produced unexpected amount of data" };
+
+			m_remaining -= generated;
+
+			return generated;
+		}
+
+	private:
+		std::size_t m_remaining;
+		const std::size_t m_size;
+		std::unique_ptr< source_t > m_source;
+};
+
+namespace impl
+{
+
+//
+// functional_body_generator_source_t
+//
+//! A body generator source that calls a function object.
+template< typename Generator >
+class functional_body_generator_source_t final
+	:	public body_generator_t::source_t
+{
+	public:
+		explicit functional_body_generator_source_t( Generator generator )
+			:	m_generator{ std::move( generator ) }
+		{}
+
+		std::size_t
+		next( char * buf, std::size_t capacity ) override
+		{
+			return m_generator( buf, capacity );
+		}
+
+	private:
+		Generator m_generator;
+};
+
+} /* namespace impl */
+
+//
+// body_generator()
+//
+/*!
+ * @brief Make a body generator from a function object.
+ *
+ * The function object has to have the following signature:
+ * @code
+ * std::size_t( char * buf, std::size_t capacity );
+ * @endcode
+ * It has to place up to @a capacity bytes into @a buf and return the
+ * count of placed bytes (a non-zero value). The function object can be
+ * move-only.
+ *
+ * Usage example:
+ * @code
+ * req->create_response()
+ * 	.append_header( restinio::http_field::content_type, "text/csv" )
+ * 	.set_body( restinio::body_generator(
+ * 		export_size,
+ * 		[cursor = open_cursor()]( char * buf, std::size_t capacity ) mutable {
+ * 			return cursor.write_next_rows( buf, capacity );
+ * 		} ) )
+ * 	.done();
+ * @endcode
+ *
+ * @since v.0.7.10
+ */
+template< typename Generator >
+[[nodiscard]]
+body_generator_t
+body_generator(
+	//! Total size of data to be generated.
+	std::size_t size,
+	//! Function object that produces data.
+	Generator generator )
+{
+	using source_t = impl::functional_body_generator_source_t<
+			std::decay_t< Generator > >;
+
+	return body_generator_t{
+			size,
+			std::make_unique< source_t >( std::move( generator ) ) };
+}
+
+} /* namespace restinio */
@@ -0,0 +1,195 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief A request body stored as a chain of buffers.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/string_view.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace restinio
+{
+
+//
+// body_rope_t
+//
+/*!
+ * @brief A body of an incoming request stored as a chain of segments.
+ *
+ * Data received from a socket is appended to the last segment. When
+ * the last segment is full a new one is allocated. Data already stored
+ * is never moved, so there are no reallocations and every byte of the
+ * body is copied only once (from the input buffer of a connection).
+ *
+ * The body can be consumed segment by segment without flattening:
+ * @code
+ * for( const auto & segment : req->body_rope() )
+ * 	file.write( segment.data(), segment.size() );
+ * @endcode
+ *
+ * A request has a body in the form of a rope only if it is turned on
+ * by server_settings_t::request_body_as_rope().
+ *
+ * @since v.0.7.10
+ */
+class body_rope_t
+{
+	public:
+		//! Default capacity of a segment.
+		static constexpr std::size_t default_segment_capacity = 64u * 1024u;
+
+		//! A segment of the body.
+		class segment_t
+		{
+			friend class body_rope_t;
+
+			public:
+				[[nodiscard]]
+				const char *
+				data() const noexcept { return m_data.get(); }
+
+				[[nodiscard]]
+				std::size_t
+				size() const noexcept { return m_size; }
+
+				[[nodiscard]]
+				string_view_t
+				view() const noexcept { return { m_data.get(), m_size }; }
+
+				operator string_view_t() const noexcept { return view(); }
+
+			private:
+				explicit segment_t( std::size_t capacity )
+					:	m_data{ std::make_unique< char[] >( capacity ) }
+					,	m_capacity{ capacity }
+				{}
+
+				std::unique_ptr< char[] > m_data;
+				std::size_t m_size{ 0u };
+				std::size_t m_capacity;
+		};
+
+		using segments_container_t = std::vector< segment_t >;
+		using const_iterator = segments_container_t::const_iterator;
+
+		body_rope_t() = default;
+
+		explicit body_rope_t( std::size_t segment_capacity )
+			:	m_segment_capacity{ std::max< std::size_t >( segment_capacity, 1u ) }
+		{}
+
+		//! Set the expected total size of the body.
+		/*!
+		 * It's used to avoid allocation of segments that are bigger than
+		 * necessary (e.g. if the size is known from `Content-Length`).
+		 */
+		void
+		expected_size( std::size_t v ) noexcept { m_expected_size = v; }
+
+		//! Append data to the end of the body.
+		void
+		append( const char * data, std::size_t length )
+		{
+			while( 0u != length )
+			{
+				if( m_segments.empty() ||
+						m_segments.back().m_size == m_segments.back().m_capacity )
+				{
+					m_segments.push_back( segment_t{ next_segment_capacity( length ) } );
+				}
+
+				auto & segment = m_segments.back();
+				const auto n = std::min( length, segment.m_capacity - segment.m_size );
+				std::memcpy( segment.m_data.get() + segment.m_size, data, n );
+
+				segment.m_size += n;
+				m_size += n;
+				data += n;
+				length -= n;
+			}
+		}
+
+		//! Total size of the body.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept { return m_size; }
+
+		[[nodiscard]]
+		bool
+		empty() const noexcept { return 0u == m_size; }
+
+		//! Count of segments.
+		[[nodiscard]]
+		std::size_t
+		segments_count() const noexcept { return m_segments.size(); }
+
+		//! Get a segment by its index.
+		[[nodiscard]]
+		const segment_t &
+		segment( std::size_t index ) const noexcept { return m_segments[ index ]; }
+
+		[[nodiscard]]
+		const_iterator
+		begin() const noexcept { return m_segments.begin(); }
+
+		[[nodiscard]]
+		const_iterator
+		end() const noexcept { return m_segments.end(); }
+
+		//! Copy the whole body into a single string.
+		[[nodiscard]]
+		std::string
+		flatten() const
+		{
+			std::string result;
+			result.reserve( m_size );
+			for( const auto & s : m_segments )
+				result.append( s.data(), s.size() );
+
+			return result;
+		}
+
+		//! Remove all data.
+		/*!
+		 * @note
+		 * Segments are released.
+		 */
+		void
+		clear() noexcept
+		{
+			m_segments.clear();
+			m_size = 0u;
+			m_expected_size = 0u;
+		}
+
+	private:
+		[[nodiscard]]
+		std::size_t
+		next_segment_capacity( std::size_t length ) const noexcept
+		{
+			// The tail of the expected body can be smaller than a segment.
+			if( m_expected_size > m_size )
+				return std::min( m_segment_capacity, m_expected_size - m_size );
+
+			return std::max( m_segment_capacity, length );
+		}
+
+		segments_container_t m_segments;
+		std::size_t m_size{ 0u };
+		std::size_t m_expected_size{ 0u };
+		std::size_t m_segment_capacity{ default_segment_capacity };
+};
+
+} /* namespace restinio */
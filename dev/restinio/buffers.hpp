@@ -14,13 +14,16 @@
 #include <new>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <restinio/asio_include.hpp>
 #include <restinio/exception.hpp>
 #include <restinio/sendfile.hpp>
+#include <restinio/body_generator.hpp>
 
 #include <restinio/compiler_features.hpp>
 #include <restinio/utils/suppress_exceptions.hpp>
+#include <restinio/utils/small_vector.hpp>
 #include <restinio/utils/impl/safe_uint_truncate.hpp>
 
 #include <restinio/impl/include_fmtlib.hpp>
@@ -375,6 +378,59 @@ struct sendfile_write_operation_t : public writable_base_t
 		std::unique_ptr< sendfile_t > m_sendfile_options;
 };
 
+//
+// body_generator_write_operation_t
+//
+
+//! Body generator wrapper.
+/*!
+	@since v.0.7.10
+*/
+class body_generator_write_operation_t final : public writable_base_t
+{
+	public:
+		body_generator_write_operation_t() = delete;
+
+		body_generator_write_operation_t( body_generator_t && generator )
+			:	m_generator{
+					std::make_unique< body_generator_t >( std::move( generator ) ) }
+		{}
+
+		body_generator_write_operation_t( const body_generator_write_operation_t & ) = delete;
+		body_generator_write_operation_t & operator = ( const body_generator_write_operation_t & ) = delete;
+
+		body_generator_write_operation_t( body_generator_write_operation_t && ) = default;
+		body_generator_write_operation_t & operator = ( body_generator_write_operation_t && ) = delete;
+
+		/*!
+			@name An implementation of writable_base_t interface.
+
+			\see writable_base_t
+		*/
+		///@{
+		virtual void relocate_to( void * storage ) override
+		{
+			new( storage ) body_generator_write_operation_t{ std::move( *this ) };
+		}
+
+		virtual std::size_t size() const override
+		{
+			return m_generator ? m_generator->size() : std::size_t{ 0 };
+		}
+		///@}
+
+		//! Get the generator.
+		body_generator_t &
+		generator() noexcept
+		{
+			return *m_generator;
+		}
+
+	private:
+		//! A pointer to the generator.
+		std::unique_ptr< body_generator_t > m_generator;
+};
+
 // Constant for suitable alignment of any entity in writable_base_t hierarchy.
 constexpr std::size_t buffer_storage_align =
 	std::max< std::size_t >( {
@@ -383,6 +439,7 @@ constexpr std::size_t buffer_storage_align =
 		alignof( string_buf_t ),
 		alignof( shared_datasizeable_buf_t< std::string > ),
 		alignof( sendfile_write_operation_t ),
+		alignof( body_generator_write_operation_t ),
 		alignof( fmt_minimal_memory_buffer_buf_t ) } );
 
 //! An of memory that is to be enough to hold any possible buffer entity.
@@ -393,6 +450,7 @@ constexpr std::size_t needed_storage_max_size =
 		sizeof( string_buf_t ),
 		sizeof( shared_datasizeable_buf_t< std::string > ),
 		sizeof( sendfile_write_operation_t ),
+		sizeof( body_generator_write_operation_t ),
 		sizeof( fmt_minimal_memory_buffer_buf_t ) } );
 
 } /* namespace impl */
@@ -446,6 +504,12 @@ enum class writable_item_type_t
 
 	//! Item is a sendfile operation and implicates file write operation.
 	file_write_operation,
+
+	//! Item is a body generator and implicates pulling of data from it.
+	/*!
+		@since v.0.7.10
+	*/
+	generator_write_operation,
 };
 
 //
@@ -461,6 +525,8 @@ enum class writable_item_type_t
 	  of a pointer to data and the size of the data).
 	  - sendfile (send a piece of data from file utilizing native
 	  sendfile support Linux/FreeBSD/macOS and TransmitFile on windows).
+	  - body generators (data is pulled from a generator by a connection
+	  piece by piece, since v.0.7.10).
 
 	Also trivial buffers are implemented diferently for different cases,
 	includeing a template classes `impl::datasizeable_buf_t<Datasizeable>` and
@@ -544,6 +610,9 @@ class writable_item_t
 				std::enable_if_t<
 					!std::is_same<
 						std::vector< writable_item_t >,
+						Datasizeable >::value &&
+					!std::is_same<
+						utils::small_vector_t< writable_item_t, 4u >,
 						Datasizeable >::value > >
 		writable_item_t( Datasizeable ds )
 			:	m_write_type{ writable_item_type_t::trivial_write_operation }
@@ -581,6 +650,15 @@ class writable_item_t
 			new( m_storage.data() ) impl::sendfile_write_operation_t{ std::move( sf_opts ) };
 		}
 
+		/*!
+			@since v.0.7.10
+		*/
+		writable_item_t( body_generator_t generator )
+			:	m_write_type{ writable_item_type_t::generator_write_operation }
+		{
+			new( m_storage.data() ) impl::body_generator_write_operation_t{ std::move( generator ) };
+		}
+
 		writable_item_t( writable_item_t && b )
 			:	m_write_type{ b.m_write_type }
 		{
@@ -634,6 +712,18 @@ class writable_item_t
 			return get_sfwo()->sendfile_options();
 		}
 
+		//! Get a reference to a body generator.
+		/*!
+			@note Stored buffer must be of writable_item_type_t::generator_write_operation.
+
+			@since v.0.7.10
+		*/
+		body_generator_t &
+		body_generator()
+		{
+			return get_gwo()->generator();
+		}
+
 	private:
 		void
 		destroy_stored_buffer()
@@ -683,6 +773,13 @@ class writable_item_t
 			return std::launder(
 					reinterpret_cast< impl::sendfile_write_operation_t * >( m_storage.data() ) );
 		}
+
+		//! Access as body_generator_write_operation_t item.
+		impl::body_generator_write_operation_t * get_gwo() noexcept
+		{
+			return std::launder(
+					reinterpret_cast< impl::body_generator_write_operation_t * >( m_storage.data() ) );
+		}
 		///@}
 
 		//! A storage for a buffer object of various types.
@@ -700,7 +797,14 @@ class writable_item_t
 // writable_items_container_t
 //
 
-using writable_items_container_t = std::vector< writable_item_t >;
+//! Container for writable items.
+/*!
+	@note
+	Since v.0.7.10 it's a vector-like container with inline storage for
+	a few items (a typical response consists of a header and a body).
+	So there is no memory allocation for the container in common cases.
+*/
+using writable_items_container_t = utils::small_vector_t< writable_item_t, 4u >;
 
 //
 // write_status_cb_t
@@ -744,6 +848,23 @@ class write_group_t
 			,	m_status_line_size{ 0 }
 		{}
 
+		//! Construct write group with items from std::vector.
+		/*!
+			It's a helper for compatibility with versions before v.0.7.10
+			where writable_items_container_t was an alias for std::vector.
+
+			@since v.0.7.10
+		*/
+		explicit write_group_t(
+			//! A buffer objects included in this group.
+			std::vector< writable_item_t > items )
+			:	m_status_line_size{ 0 }
+		{
+			m_items.reserve( items.size() );
+			for( auto & item : items )
+				m_items.emplace_back( std::move( item ) );
+		}
+
 		/** @name Copy semantics.
 		 * @brief Not allowed.
 		*/
@@ -919,8 +1040,8 @@ class write_group_t
 			m_items.reserve( m_items.size() + second_items.size() );
 
 			std::move(
-				begin( second_items ),
-				end( second_items ),
+				second_items.begin(),
+				second_items.end(),
 				std::back_inserter( m_items ) );
 
 			m_after_write_notificator = std::move( second.m_after_write_notificator );
@@ -227,6 +227,64 @@ public:
 		}
 	}
 
+	/*!
+	 * @brief Try to reserve a place for an extra accept() operation.
+	 *
+	 * It's used by the acceptor for draining the listen backlog after
+	 * the completion of an ordinary accept operation.
+	 *
+	 * If true is returned then m_active_accepts is incremented and
+	 * the acceptor has to either create a connection (it leads to
+	 * a call to increment_parallel_connections()) or to call
+	 * cancel_extra_accept().
+	 *
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	bool
+	try_reserve_extra_accept() noexcept
+	{
+		std::lock_guard< Mutex_Type > lock{ m_lock };
+
+		if( has_free_slots() )
+		{
+			++m_active_accepts;
+			return true;
+		}
+
+		return false;
+	}
+
+	/*!
+	 * @brief Cancel a reservation made by try_reserve_extra_accept().
+	 *
+	 * @since v.0.7.10
+	 */
+	void
+	cancel_extra_accept() noexcept
+	{
+		auto index_to_activate = [this]() -> std::optional<std::size_t> {
+			std::lock_guard< Mutex_Type > lock{ m_lock };
+
+			// Expects that m_active_accepts is always greater than 0.
+			--m_active_accepts;
+
+			if( has_free_slots() && !m_pending_indexes.empty() )
+			{
+				std::size_t pending_index = m_pending_indexes.back();
+				m_pending_indexes.pop_back();
+				return pending_index;
+			}
+			else
+				return std::nullopt;
+		}();
+
+		if( index_to_activate )
+		{
+			m_acceptor->schedule_next_accept_attempt( *index_to_activate );
+		}
+	}
+
 	/*!
 	 * This method either calls acceptor_callback_iface_t::call_accept_now() (in
 	 * that case m_active_accepts is incremented) or stores @a index into the
@@ -286,6 +344,21 @@ public:
 	void
 	decrement_parallel_connections() noexcept { /* Nothing to do */ }
 
+	/*!
+	 * Always allows an extra accept.
+	 *
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	bool
+	try_reserve_extra_accept() noexcept { return true; }
+
+	/*!
+	 * @since v.0.7.10
+	 */
+	void
+	cancel_extra_accept() noexcept { /* Nothing to do */ }
+
 	/*!
 	 * Calls acceptor_callback_iface_t::call_accept_now() directly.
 	 * The @a index is never stored anywhere.
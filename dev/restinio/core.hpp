@@ -20,6 +20,7 @@
 #include <restinio/http_server.hpp>
 #include <restinio/http_server_run.hpp>
 #include <restinio/asio_timer_manager.hpp>
+#include <restinio/timer_wheel_manager.hpp>
 #include <restinio/null_timer_manager.hpp>
 #include <restinio/null_logger.hpp>
 #include <restinio/ostream_logger.hpp>
@@ -28,4 +29,5 @@
 #include <restinio/value_or.hpp>
 
 #include <restinio/router/express.hpp>
+#include <restinio/router/radix_express.hpp>
 
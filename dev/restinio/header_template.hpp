@@ -0,0 +1,143 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Pre-serialized set of response header fields.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/http_headers.hpp>
+#include <restinio/buffers.hpp>
+#include <restinio/string_view.hpp>
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+namespace restinio
+{
+
+//
+// header_template_t
+//
+/*!
+ * @brief An immutable set of header fields serialized only once.
+ *
+ * Many responses have the same fields (like `Server`, `Content-Type`
+ * or `Cache-Control`). Such fields can be collected into a header
+ * template that is created once (e.g. at the start of a server). The
+ * serialized representation of the template is shared between responses:
+ * it's added to the output as a separate buffer without any copying and
+ * formatting, only fields specific to a particular response are
+ * serialized by a response builder.
+ *
+ * Usage example:
+ * @code
+ * const restinio::header_template_t common_fields{
+ * 	{ restinio::http_field::server, "My server" },
+ * 	{ restinio::http_field::content_type, "text/plain; charset=utf-8" },
+ * 	{ restinio::http_field::cache_control, "no-cache" }
+ * };
+ * ...
+ * req->create_response()
+ * 	.use_header_template( common_fields )
+ * 	.append_header_date_field()
+ * 	.set_body( "Hello, World!" )
+ * 	.done();
+ * @endcode
+ *
+ * @note
+ * It's cheap to copy a template because the serialized representation
+ * is held by a shared pointer.
+ *
+ * @attention
+ * Fields from a template aren't visible via the header of a response
+ * builder, so they should not be duplicated by fields of the header.
+ *
+ * @since v.0.7.10
+ */
+class header_template_t
+{
+	public:
+		//! Create an empty template.
+		header_template_t() = default;
+
+		header_template_t( std::initializer_list< http_header_field_t > fields )
+			:	m_serialized{ serialize( fields ) }
+		{}
+
+		explicit header_template_t( const http_header_fields_t & fields )
+			:	m_serialized{ serialize( fields ) }
+		{}
+
+		//! Is there any field in the template?
+		[[nodiscard]]
+		bool
+		empty() const noexcept { return !m_serialized; }
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept { return !empty(); }
+
+		//! Get the serialized fields.
+		/*!
+		 * Every field is finished by "\r\n". The final "\r\n" of the
+		 * header is not included.
+		 */
+		[[nodiscard]]
+		string_view_t
+		serialized_fields() const noexcept
+		{
+			if( empty() )
+				return {};
+
+			return string_view_t{ *m_serialized }.substr(
+					0u, m_serialized->size() - 2u );
+		}
+
+		//! Get a buffer with serialized fields and the final "\r\n".
+		/*!
+		 * The buffer shares the serialized representation.
+		 *
+		 * @attention
+		 * Must not be called for an empty template.
+		 */
+		[[nodiscard]]
+		writable_item_t
+		make_writable_item() const
+		{
+			return writable_item_t{ m_serialized };
+		}
+
+	private:
+		//! Serialized fields followed by the final "\r\n" of the header.
+		std::shared_ptr< const std::string > m_serialized;
+
+		template< typename Fields >
+		[[nodiscard]]
+		static std::shared_ptr< const std::string >
+		serialize( const Fields & fields )
+		{
+			std::string result;
+			for( const auto & f : fields )
+			{
+				result.append( f.name() );
+				result.append( ": " );
+				result.append( f.value() );
+				result.append( "\r\n" );
+			}
+
+			if( result.empty() )
+				return {};
+
+			result.append( "\r\n" );
+
+			return std::make_shared< const std::string >( std::move( result ) );
+		}
+};
+
+} /* namespace restinio */
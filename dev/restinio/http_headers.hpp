@@ -23,6 +23,9 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <bitset>
+#include <memory>
 #include <optional>
 
 namespace restinio
@@ -242,305 +245,145 @@ enum class http_field_t : std::uint8_t //By now 152 + 34 + 1 items fits to uint8
 //! Helper alies to omitt `_t` suffix.
 using http_field = http_field_t;
 
+namespace impl
+{
+
+namespace field_hash_details
+{
+
+//! Lower case for ASCII letters that can be used at compile time.
+constexpr char
+to_lower_ascii( char ch ) noexcept
+{
+	return ( ch >= 'A' && ch <= 'Z' ) ? static_cast< char >( ch - 'A' + 'a' ) : ch;
+}
+
+//! Caseless FNV-1a hash of a field name.
+constexpr std::uint32_t
+hash_caseless( const char * name, std::size_t size ) noexcept
+{
+	std::uint32_t result = 2166136261u;
+	for( std::size_t i = 0u; i != size; ++i )
+	{
+		result ^= static_cast< unsigned char >( to_lower_ascii( name[ i ] ) );
+		result *= 16777619u;
+	}
+
+	return result;
+}
+
+//! Count of known fields.
+constexpr std::size_t known_fields_count =
+	static_cast< std::size_t >( http_field_t::field_unspecified );
+
+//! A name of a known field.
+struct field_name_t
+{
+	const char * m_name;
+	std::size_t m_size;
+};
+
+//! Names of known fields in the order of http_field_t items.
+constexpr field_name_t field_names[ known_fields_count ] = {
+#define RESTINIO_HTTP_FIELD_NAME_GEN( ignored, string_name ) \
+	{ #string_name, sizeof( #string_name ) - 1u },
+	RESTINIO_HTTP_FIELDS_MAP( RESTINIO_HTTP_FIELD_NAME_GEN )
+#undef RESTINIO_HTTP_FIELD_NAME_GEN
+};
+
+//! Size of the hash table (must be a power of 2).
+constexpr std::size_t table_size = 1024u;
+constexpr std::uint32_t table_mask = table_size - 1u;
+
+//! A mark for an empty slot in the hash table.
+constexpr std::uint8_t empty_slot = 0xFFu;
+
+static_assert( known_fields_count < empty_slot,
+		"http_field_t values should fit into a slot of the hash table" );
+
+//! Hash table for known fields that is built at compile time.
+struct table_t
+{
+	//! Indexes of fields (values of http_field_t) or empty_slot.
+	std::uint8_t m_slots[ table_size ];
+	//! The max length of a name of a known field.
+	std::size_t m_max_name_size;
+	//! The max number of probes required to find a known field.
+	std::size_t m_max_probes;
+};
+
+constexpr table_t
+make_table() noexcept
+{
+	table_t result{ {}, 0u, 0u };
+	for( auto & slot : result.m_slots )
+		slot = empty_slot;
+
+	for( std::size_t i = 0u; i != known_fields_count; ++i )
+	{
+		const auto & f = field_names[ i ];
+		if( f.m_size > result.m_max_name_size )
+			result.m_max_name_size = f.m_size;
+
+		std::size_t probes = 1u;
+		auto pos = hash_caseless( f.m_name, f.m_size ) & table_mask;
+		while( empty_slot != result.m_slots[ pos ] )
+		{
+			pos = ( pos + 1u ) & table_mask;
+			++probes;
+		}
+
+		result.m_slots[ pos ] = static_cast< std::uint8_t >( i );
+		if( probes > result.m_max_probes )
+			result.m_max_probes = probes;
+	}
+
+	return result;
+}
+
+inline constexpr table_t table = make_table();
+
+static_assert( table.m_max_probes <= 4u,
+		"too many collisions in the hash table of field names" );
+
+} /* namespace field_hash_details */
+
+} /* namespace impl */
+
 //
 // string_to_field()
 //
 
 //! Helper function to get method string name.
-//! \{
+/*!
+ * @note
+ * Since v.0.7.10 a hash table that is built at compile time is used.
+ * A name of a field is hashed once and then compared with the only
+ * candidate (or with a couple of candidates in the case of collision).
+ */
 inline http_field_t
 string_to_field( string_view_t field ) noexcept
 {
-	const char * field_name = field.data();
-	const std::size_t field_name_size = field.size();
-
-#define RESTINIO_HTTP_CHECK_FOR_FIELD( field_id, candidate_field_name ) \
-	if( impl::is_equal_caseless(field_name, #candidate_field_name , field_name_size ) ) \
-		return http_field_t:: field_id;
+	using namespace impl::field_hash_details;
 
-	// TODO: make most popular fields to be checked first.
+	if( field.size() > table.m_max_name_size )
+		return http_field_t::field_unspecified;
 
-	switch( field_name_size )
+	auto pos = hash_caseless( field.data(), field.size() ) & table_mask;
+	for( std::uint8_t slot = table.m_slots[ pos ];
+			empty_slot != slot;
+			slot = table.m_slots[ pos ] )
 	{
-		case 2:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_,                          If )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( im,                           IM )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( te,                           TE )
-			break;
-
-		case 3:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( age,                          Age )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( dav,                          DAV )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ext,                          Ext )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( man,                          Man )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( opt,                          Opt )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( p3p,                          P3P )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pep,                          PEP )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( tcn,                          TCN )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ttl,                          TTL )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( uri,                          URI )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( via,                          Via )
-			break;
-
-		case 4:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( host,                         Host )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( a_im,                         A-IM )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alpn,                         ALPN )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( dasl,                         DASL )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( date,                         Date )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( etag,                         ETag )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( from,                         From )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( link,                         Link )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( safe,                         Safe )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( slug,                         SLUG )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( vary,                         Vary )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cost,                         Cost )
-			break;
-
-		case 5:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( allow,                        Allow )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_ext,                        C-Ext )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_man,                        C-Man )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_opt,                        C-Opt )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_pep,                        C-PEP )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( close,                        Close )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( depth,                        Depth )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( label,                        Label )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( meter,                        Meter )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( range,                        Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( topic,                        Topic )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( subok,                        SubOK )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( subst,                        Subst )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( title,                        Title )
-			break;
-
-		case 6:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept,                       Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cookie,                       Cookie )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( server,                       Server )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( digest,                       Digest )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( expect,                       Expect )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( origin,                       Origin )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pragma,                       Pragma )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( prefer,                       Prefer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_,                      Public )
-			break;
-
-		case 7:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alt_svc,                      Alt-Svc )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cookie2,                      Cookie2 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( expires,                      Expires )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( hobareg,                      Hobareg )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( referer,                      Referer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( timeout,                      Timeout )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( trailer,                      Trailer )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( urgency,                      Urgency )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( upgrade,                      Upgrade )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( warning,                      Warning )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( version,                      Version )
-			break;
-
-		case 8:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alt_used,                     Alt-Used )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_match,                     If-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_range,                     If-Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( location,                     Location )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pep_info,                     Pep-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( position,                     Position )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol,                     Protocol )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( optional,                     Optional )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_color,                     UA-Color )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_media,                     UA-Media )
-			break;
-
-		case 9:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( forwarded,                    Forwarded )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( negotiate,                    Negotiate )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( overwrite,                    Overwrite )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_pixels,                    UA-Pixels )
-			break;
-
-		case 10:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( alternates,                   Alternates )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( c_pep_info,                   C-PEP-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_id,                   Content-ID )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( delta_base,                   Delta-Base )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( getprofile,                   GetProfile )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( keep_alive,                   Keep-Alive )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( lock_token,                   Lock-Token )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( pics_label,                   PICS-Label )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( set_cookie,                   Set-Cookie )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( setprofile,                   SetProfile )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( soapaction,                   SoapAction )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( status_uri,                   Status-URI )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( user_agent,                   User-Agent )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( compliance,                   Compliance )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( message_id,                   Message-ID )
-			break;
-
-		case 11:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_post,                  Accept-Post )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_md5,                  Content-MD5 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( destination,                  Destination )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( retry_after,                  Retry-After )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( set_cookie2,                  Set-Cookie2 )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( want_digest,                  Want-Digest )
-			break;
-
-		case 12:
-			// Known to be more used first:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_type,                 Content-Type )
-
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_patch,                 Accept-Patch )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_base,                 Content-Base )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( derived_from,                 Derived-From )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( max_forwards,                 Max-Forwards )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( mime_version,                 MIME-Version )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( schedule_tag,                 Schedule-Tag )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( redirect_ref,                 Redirect-Ref )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( variant_vary,                 Variant-Vary )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( method_check,                 Method-Check )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( referer_root,                 Referer-Root )
-			break;
-
-		case 13:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_ranges,                Accept-Ranges )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authorization,                Authorization )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( cache_control,                Cache-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_range,                Content-Range )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( default_style,                Default-Style )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_none_match,                If-None-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( last_modified,                Last-Modified )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ordering_type,                Ordering-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( profileobject,                ProfileObject )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_info,                Protocol-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_resolution,                UA-Resolution )
-			break;
-
-		case 14:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_charset,               Accept-Charset )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( http2_settings,               HTTP2-Settings )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_query,               Protocol-Query )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_features,               Proxy-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( schedule_reply,               Schedule-Reply )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( non_compliance,               Non-Compliance )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control,               Access-Control )
-			break;
-
-		case 15:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_encoding,              Accept-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_features,              Accept-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_language,              Accept-Language )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_datetime,              Accept-Datetime )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_version,              Content-Version )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( differential_id,              Differential-ID )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_key_pins,              Public-Key-Pins )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( security_scheme,              Security-Scheme )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_frame_options,              X-Frame-Options )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept,              X-Device-Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( resolution_hint,              Resolution-Hint )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ediint_features,              EDIINT-Features )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( ua_windowpixels,              UA-Windowpixels )
-			break;
-
-		case 16:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( accept_additions,             Accept-Additions )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( caldav_timezones,             CalDAV-Timezones )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_encoding,             Content-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_language,             Content-Language )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_location,             Content-Location )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( memento_datetime,             Memento-Datetime )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( protocol_request,             Protocol-Request )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( www_authenticate,             WWW-Authenticate )
-			break;
-
-		case 17:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_modified_since,            If-Modified-Since )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_instruction,            Proxy-Instruction )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_key,            Sec-WebSocket-Key )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( surrogate_control,            Surrogate-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( transfer_encoding,            Transfer-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( resolver_location,            Resolver-Location )
-			break;
-
-		case 18:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_style_type,           Content-Style-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( preference_applied,           Preference-Applied )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authenticate,           Proxy-Authenticate )
-			break;
-
-		case 19:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authentication_info,          Authentication-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_disposition,          Content-Disposition )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_script_type,          Content-Script-Type )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_unmodified_since,          If-Unmodified-Since )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authorization,          Proxy-Authorization )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_user_agent,          X-Device-User-Agent )
-			break;
-
-		case 20:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_accept,         Sec-WebSocket-Accept )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( surrogate_capability,         Surrogate-Capability )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( method_check_expires,         Method-Check-Expires )
-			break;
-
-		case 21:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( apply_to_redirect_ref,        Apply-To-Redirect-Ref )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( if_schedule_tag_match,        If-Schedule-Tag-Match )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_version,        Sec-WebSocket-Version )
-			break;
-
-		case 22:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( authentication_control,       Authentication-Control )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_protocol,       Sec-WebSocket-Protocol )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_max_age,       Access-Control-Max-Age )
-			break;
-
-		case 23:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_charset,      X-Device-Accept-Charset )
-			break;
-
-		case 24:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( sec_websocket_extensions,     Sec-WebSocket-Extensions )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_encoding,     X-Device-Accept-Encoding )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( x_device_accept_language,     X-Device-Accept-Language )
-			break;
-
-		case 25:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( optional_www_authenticate,    Optional-WWW-Authenticate )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( proxy_authentication_info,    Proxy-Authentication-Info )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( strict_transport_security,    Strict-Transport-Security )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( content_transfer_encoding,    Content-Transfer-Encoding )
-			break;
-
-		case 27:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( public_key_pins_report_only,  Public-Key-Pins-Report-Only )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_origin,  Access-Control-Allow-Origin )
-			break;
-
-		case 28:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_headers, Access-Control-Allow-Headers )
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_methods, Access-Control-Allow-Methods )
-			break;
-
-		case 29:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_request_method,    Access-Control-Request-Method )
-			break;
-
-		case 30:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_request_headers,   Access-Control-Request-Headers )
-			break;
-
-		case 32:
-			RESTINIO_HTTP_CHECK_FOR_FIELD( access_control_allow_credentials, Access-Control-Allow-Credentials )
-			break;
-	}
+		const auto & candidate = field_names[ slot ];
+		if( impl::is_equal_caseless(
+				field.data(), field.size(),
+				candidate.m_name, candidate.m_size ) )
+		{
+			return static_cast< http_field_t >( slot );
+		}
 
-#undef RESTINIO_HTTP_CHECK_FOR_FIELD
+		pos = ( pos + 1u ) & table_mask;
+	}
 
 	return http_field_t::field_unspecified;
 }
@@ -655,19 +498,95 @@ class http_header_field_t
 		http_field_t m_field_id;
 };
 
-// Make neccessary forward declarations.
-class http_header_fields_t;
+#if !defined( RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT )
+	#define RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT 4
+#endif
+
+/*!
+ * @brief The count of fields at which the index of known fields
+ * is created in http_header_fields_t.
+ *
+ * Value 0 disables the index.
+ *
+ * @since v.0.7.10
+ */
+#if !defined( RESTINIO_HEADER_FIELDS_INDEX_THRESHOLD )
+	#define RESTINIO_HEADER_FIELDS_INDEX_THRESHOLD 16
+#endif
+
 namespace impl
 {
 
-void
-append_last_field_accessor( http_header_fields_t &, string_view_t );
+//
+// http_field_index_t
+//
 
-} /* namespace impl */
+/*!
+ * @brief Index of the first occurrences of known fields.
+ *
+ * Holds a bit for every value of http_field_t (is there such field
+ * in the container) and the position of the first occurrence of the field.
+ *
+ * @since v.0.7.10
+ */
+class http_field_index_t
+{
+	public:
+		//! Value for the case when a field isn't found.
+		static constexpr std::size_t npos = static_cast< std::size_t >( -1 );
 
-#if !defined( RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT )
-	#define RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT 4
-#endif
+		//! The max count of fields that can be indexed.
+		static constexpr std::size_t max_indexed_fields = 0xFFFFu;
+
+		//! Register a field added to the end of the container.
+		void
+		on_field_added( http_field_t field_id, std::size_t position ) noexcept
+		{
+			if( http_field_t::field_unspecified != field_id )
+			{
+				const auto index = static_cast< std::size_t >( field_id );
+				if( !m_present.test( index ) )
+				{
+					m_present.set( index );
+					m_first_positions[ index ] =
+							static_cast< std::uint16_t >( position );
+				}
+			}
+		}
+
+		//! Build the index for a container of fields from scratch.
+		template< typename Container >
+		void
+		rebuild( const Container & fields ) noexcept
+		{
+			m_present.reset();
+
+			std::size_t position = 0u;
+			for( const auto & f : fields )
+				on_field_added( f.field_id(), position++ );
+		}
+
+		//! Get the position of the first occurrence of a field.
+		/*!
+		 * @return npos if there is no such field.
+		 */
+		[[nodiscard]]
+		std::size_t
+		first_position( http_field_t field_id ) const noexcept
+		{
+			const auto index = static_cast< std::size_t >( field_id );
+			return m_present.test( index ) ? m_first_positions[ index ] : npos;
+		}
+
+	private:
+		static constexpr std::size_t fields_count =
+			static_cast< std::size_t >( http_field_t::field_unspecified );
+
+		std::bitset< fields_count + 1u > m_present;
+		std::array< std::uint16_t, fields_count > m_first_positions{};
+};
+
+} /* namespace impl */
 
 //
 // http_header_fields_t
@@ -702,9 +621,6 @@ append_last_field_accessor( http_header_fields_t &, string_view_t );
 */
 class http_header_fields_t
 {
-		friend void
-		impl::append_last_field_accessor( http_header_fields_t &, string_view_t );
-
 	public:
 		using fields_container_t = std::vector< http_header_field_t >;
 
@@ -737,17 +653,32 @@ class http_header_fields_t
 		{
 			m_fields.reserve( RESTINIO_HEADER_FIELDS_DEFAULT_RESERVE_COUNT );
 		}
-		http_header_fields_t(const http_header_fields_t &) = default;
+		http_header_fields_t(const http_header_fields_t & other)
+			:	m_fields{ other.m_fields }
+			,	m_index{ other.m_index
+					? std::make_unique< impl::http_field_index_t >( *other.m_index )
+					: nullptr }
+		{}
 		http_header_fields_t(http_header_fields_t &&) = default;
 		virtual ~http_header_fields_t() {}
 
-		http_header_fields_t & operator=(const http_header_fields_t &) = default;
+		http_header_fields_t & operator=(const http_header_fields_t & other)
+		{
+			if( this != &other )
+			{
+				http_header_fields_t tmp{ other };
+				m_fields = std::move( tmp.m_fields );
+				m_index = std::move( tmp.m_index );
+			}
+			return *this;
+		}
 		http_header_fields_t & operator=(http_header_fields_t &&) = default;
 
 		void
 		swap_fields( http_header_fields_t & http_header_fields )
 		{
 			std::swap( m_fields, http_header_fields.m_fields );
+			std::swap( m_index, http_header_fields.m_index );
 		}
 
 		//! Check field by name.
@@ -793,7 +724,7 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back( std::move( http_header_field ) );
+				emplace_field( std::move( http_header_field ) );
 			}
 		}
 
@@ -812,7 +743,7 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back(
+				emplace_field(
 					std::move( field_name ),
 					std::move( field_value ) );
 			}
@@ -838,7 +769,7 @@ class http_header_fields_t
 				}
 				else
 				{
-					m_fields.emplace_back(
+					emplace_field(
 						field_id,
 						std::move( field_value ) );
 				}
@@ -864,7 +795,7 @@ class http_header_fields_t
 		{
 			if( http_field_t::field_unspecified != field_id )
 			{
-				m_fields.emplace_back(
+				emplace_field(
 					field_id,
 					std::move( field_value ) );
 			}
@@ -884,7 +815,7 @@ class http_header_fields_t
 			std::string field_name,
 			std::string field_value )
 		{
-			m_fields.emplace_back(
+			emplace_field(
 				std::move( field_name ),
 				std::move( field_value ) );
 		}
@@ -901,7 +832,7 @@ class http_header_fields_t
 		void
 		add_field( http_header_field_t http_header_field )
 		{
-			m_fields.push_back( std::move(http_header_field) );
+			emplace_field( std::move(http_header_field) );
 		}
 
 		//! Append field with name.
@@ -918,7 +849,7 @@ class http_header_fields_t
 			}
 			else
 			{
-				m_fields.emplace_back( field_name, field_value );
+				emplace_field( field_name, field_value );
 			}
 		}
 
@@ -942,7 +873,7 @@ class http_header_fields_t
 				}
 				else
 				{
-					m_fields.emplace_back( field_id, field_value );
+					emplace_field( field_id, field_value );
 				}
 			}
 		}
@@ -1179,7 +1110,7 @@ class http_header_fields_t
 
 			if( m_fields.end() != it )
 			{
-				m_fields.erase( it );
+				erase_field( it );
 				return true;
 			}
 
@@ -1205,7 +1136,7 @@ class http_header_fields_t
 
 				if( m_fields.end() != it )
 				{
-					m_fields.erase( it );
+					erase_field( it );
 					return true;
 				}
 			}
@@ -1234,6 +1165,9 @@ class http_header_fields_t
 					++it;
 			}
 
+			if( count )
+				rebuild_index();
+
 			return count;
 		}
 
@@ -1259,6 +1193,9 @@ class http_header_fields_t
 					else
 						++it;
 				}
+
+				if( count )
+					rebuild_index();
 			}
 
 			return count;
@@ -1413,8 +1350,14 @@ class http_header_fields_t
 				>::value,
 				"lambda should return restinio::http_header_fields_t::handling_result_t" );
 
-			for( const auto & f : m_fields )
+			auto it = m_fields.cbegin();
+			if( m_index && http_field_t::field_unspecified != field_id )
+				// All occurrences are placed after the first one.
+				it += static_cast< std::ptrdiff_t >( indexed_position( field_id ) );
+
+			for( ; it != m_fields.cend(); ++it )
 			{
+				const auto & f = *it;
 				if( field_id == f.field_id() )
 				{
 					const handling_result_t r = lambda( f.value() );
@@ -1498,24 +1441,86 @@ class http_header_fields_t
 		}
 
 	private:
-		//! Appends last added field.
+		//! Add a new field to the end of the container.
+		/*!
+		 * Updates the index of known fields (or creates it if there are
+		 * enough fields).
+		 *
+		 * @since v.0.7.10
+		 */
+		template< typename... Args >
+		void
+		emplace_field( Args && ...args )
+		{
+			m_fields.emplace_back( std::forward< Args >( args )... );
+
+			if( m_index )
+			{
+				if( m_fields.size() <= impl::http_field_index_t::max_indexed_fields )
+					m_index->on_field_added(
+							m_fields.back().field_id(),
+							m_fields.size() - 1u );
+				else
+					m_index.reset();
+			}
+			else if( 0u != RESTINIO_HEADER_FIELDS_INDEX_THRESHOLD &&
+					RESTINIO_HEADER_FIELDS_INDEX_THRESHOLD == m_fields.size() )
+			{
+				m_index = std::make_unique< impl::http_field_index_t >();
+				m_index->rebuild( m_fields );
+			}
+		}
+
+		//! Remove a field from the container.
 		/*!
-			This is function is used by http-parser when
-			field value is created by 2 separate
-			invocation of on-header-field-value callback
+		 * @since v.0.7.10
+		 */
+		void
+		erase_field( fields_container_t::iterator it ) noexcept
+		{
+			m_fields.erase( it );
+			rebuild_index();
+		}
 
-			Function doesn't check if at least one field exists,
-			so it is not in the public interface.
-		*/
+		//! Update the index of known fields after removal of fields.
+		/*!
+		 * @since v.0.7.10
+		 */
 		void
-		append_last_field( string_view_t field_value )
+		rebuild_index() noexcept
+		{
+			if( m_index )
+				m_index->rebuild( m_fields );
+		}
+
+		//! Get the position of the first occurrence of a known field.
+		/*!
+		 * @return impl::http_field_index_t::npos if there is no such field.
+		 *
+		 * @note
+		 * Can be called only if there is the index of known fields and
+		 * @a field_id isn't http_field_t::field_unspecified.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::size_t
+		indexed_position( http_field_t field_id ) const noexcept
 		{
-			m_fields.back().append_value( field_value );
+			const auto pos = m_index->first_position( field_id );
+			return impl::http_field_index_t::npos == pos ? m_fields.size() : pos;
 		}
 
 		fields_container_t::iterator
 		find( string_view_t field_name ) noexcept
 		{
+			if( m_index )
+			{
+				const auto field_id = string_to_field( field_name );
+				if( http_field_t::field_unspecified != field_id )
+					return m_fields.begin() + static_cast< std::ptrdiff_t >(
+							indexed_position( field_id ) );
+			}
+
 			return std::find_if(
 				m_fields.begin(),
 				m_fields.end(),
@@ -1527,6 +1532,14 @@ class http_header_fields_t
 		fields_container_t::const_iterator
 		cfind( string_view_t field_name ) const noexcept
 		{
+			if( m_index )
+			{
+				const auto field_id = string_to_field( field_name );
+				if( http_field_t::field_unspecified != field_id )
+					return m_fields.cbegin() + static_cast< std::ptrdiff_t >(
+							indexed_position( field_id ) );
+			}
+
 			return std::find_if(
 				m_fields.cbegin(),
 				m_fields.cend(),
@@ -1538,6 +1551,10 @@ class http_header_fields_t
 		fields_container_t::iterator
 		find( http_field_t field_id ) noexcept
 		{
+			if( m_index && http_field_t::field_unspecified != field_id )
+				return m_fields.begin() + static_cast< std::ptrdiff_t >(
+						indexed_position( field_id ) );
+
 			return std::find_if(
 				m_fields.begin(),
 				m_fields.end(),
@@ -1549,6 +1566,10 @@ class http_header_fields_t
 		fields_container_t::const_iterator
 		cfind( http_field_t field_id ) const noexcept
 		{
+			if( m_index && http_field_t::field_unspecified != field_id )
+				return m_fields.cbegin() + static_cast< std::ptrdiff_t >(
+						indexed_position( field_id ) );
+
 			return std::find_if(
 				m_fields.cbegin(),
 				m_fields.cend(),
@@ -1558,6 +1579,17 @@ class http_header_fields_t
 		}
 
 		fields_container_t m_fields;
+
+		/*!
+		 * @brief Index of known fields.
+		 *
+		 * Is created only when the count of fields reaches
+		 * RESTINIO_HEADER_FIELDS_INDEX_THRESHOLD, so small headers
+		 * don't pay for it.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::unique_ptr< impl::http_field_index_t > m_index;
 };
 
 //
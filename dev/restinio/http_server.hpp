@@ -195,6 +195,9 @@ class http_server_t
 			basic_server_settings_t< D, Traits > && settings )
 			:	m_io_context{ io_context.giveaway_context() }
 			,	m_cleanup_functor{ settings.giveaway_cleanup_func() }
+			,	m_connection_pool{
+					impl::make_connection_pool(
+						settings.connection_pool_capacity() ) }
 		{
 			// Since v.0.5.1 the presence of custom connection state
 			// listener should be checked before the start of HTTP server.
@@ -213,7 +216,8 @@ class http_server_t
 				std::make_shared< connection_settings_t >(
 					std::forward< actual_settings_type >(settings),
 					impl::create_parser_settings< typename Traits::http_methods_mapper_t >(),
-					m_timer_manager );
+					m_timer_manager,
+					m_connection_pool );
 
 			m_acceptor =
 				std::make_shared< acceptor_t >(
@@ -252,6 +256,29 @@ class http_server_t
 		//! Get io_context on which server runs.
 		asio_ns::io_context & io_context() noexcept { return *m_io_context; }
 
+		/*!
+		 * @brief Get statistics of the pool of connection objects.
+		 *
+		 * Returns zero statistics if the pool isn't used (see
+		 * basic_server_settings_t::connection_pool_capacity()).
+		 *
+		 * @note
+		 * This method is thread safe: the pool is created in
+		 * the constructor and isn't changed after that, and the pool
+		 * protects its statistics by a mutex.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		connection_pool_stats_t
+		connection_pool_stats() const
+		{
+			if( m_connection_pool )
+				return m_connection_pool->stats();
+
+			return {};
+		}
+
 		//! Starts server in async way.
 		/*!
 			\note It is necessary to be sure that ioservice is running.
@@ -398,6 +425,18 @@ class http_server_t
 		//! Timer manager object.
 		timer_manager_handle_t m_timer_manager;
 
+		/*!
+		 * @brief Pool of connection objects.
+		 *
+		 * It's nullptr if the pool isn't used.
+		 *
+		 * It's created in the constructor and isn't changed after that,
+		 * so it can be read from any thread.
+		 *
+		 * @since v.0.7.10
+		 */
+		const impl::connection_pool_handle_t m_connection_pool;
+
 		//! State of server.
 		enum class running_state_t
 		{
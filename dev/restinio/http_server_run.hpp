@@ -13,6 +13,9 @@
 
 #include <restinio/http_server.hpp>
 
+#include <atomic>
+#include <mutex>
+
 #if defined(RESTINIO_DEFAULT_BREAK_SIGNALS_LIST)
 #error "RESTINIO_DEFAULT_BREAK_SIGNALS_LIST symbol should not be defined by user"
 #else
@@ -1007,6 +1010,493 @@ public :
 	wait() noexcept { m_pool.wait(); }
 };
 
+namespace impl
+{
+
+namespace sharded_run_details
+{
+
+#if defined(SO_REUSEPORT)
+/*!
+ * @brief Acceptor option for enabling SO_REUSEPORT.
+ *
+ * Asio doesn't provide such option, so it's defined the same way
+ * as Asio defines reuse_address option.
+ *
+ * @since v.0.7.10
+ */
+using reuse_port_t = asio_ns::detail::socket_option::boolean<
+		SOL_SOCKET, SO_REUSEPORT >;
+#endif
+
+/*!
+ * @brief Creates settings for a shard of shard-per-thread mode.
+ *
+ * Calls the user's configurator and then makes the changes necessary
+ * for having several acceptors on the same port: if there are several
+ * shards then SO_REUSEPORT option is set for every acceptor (after
+ * the options from user's acceptor options setter).
+ *
+ * Throws if SO_REUSEPORT is not supported by the platform or if
+ * port 0 is used (every shard should bind to the same port).
+ *
+ * @since v.0.7.10
+ */
+template< typename Traits, typename Shard_Configurator >
+[[nodiscard]]
+server_settings_t< Traits >
+make_shard_settings(
+	std::size_t shard_index,
+	std::size_t shards_count,
+	Shard_Configurator & configurator )
+{
+	server_settings_t< Traits > settings;
+	configurator( shard_index, settings );
+
+	if( 1u < shards_count )
+	{
+#if defined(SO_REUSEPORT)
+		if( 0u == settings.port() )
+			throw exception_t{
+				"port 0 can't be used in shard-per-thread mode, "
+				"all shards have to be bound to the same port" };
+
+		std::shared_ptr< acceptor_options_setter_t > user_setter{
+				settings.acceptor_options_setter() };
+
+		settings.acceptor_options_setter(
+			[user_setter]( acceptor_options_t & options ) {
+				(*user_setter)( options );
+				options.set_option( reuse_port_t{ true } );
+			} );
+#else
+		throw exception_t{
+			"SO_REUSEPORT is not supported on this platform, "
+			"shard-per-thread mode can be used only with one shard" };
+#endif
+	}
+
+	return settings;
+}
+
+} /* namespace sharded_run_details */
+
+} /* namespace impl */
+
+//
+// sharded_on_pool_runner_t
+//
+/*!
+ * @brief Helper class for running HTTP-server in shard-per-thread mode
+ * without blocking the current thread.
+ *
+ * Unlike on_pool_runner_t that runs a single HTTP-server on several
+ * threads with one shared io_context, sharded_on_pool_runner_t creates
+ * a separate io_context for every thread (a shard) and a separate
+ * instance of HTTP-server for every shard. Every HTTP-server has its own
+ * acceptor, all acceptors are bound to the same port with SO_REUSEPORT
+ * option, so incoming connections are distributed between shards by the
+ * OS kernel. A connection is always served by the shard that accepted it.
+ *
+ * Because the io_context of a shard is run only on one thread there is
+ * no need in strands, so traits with noop_strand_t (like
+ * default_single_thread_traits_t) are the natural choice for
+ * HTTP-server type.
+ *
+ * Settings for every HTTP-server are created by a user-supplied
+ * configurator that is called for every shard. It is necessary because
+ * settings hold unique objects like request handler and logger. The
+ * configurator should be a function/functor with the format:
+ * @code
+ * void (std::size_t shard_index, restinio::server_settings_t<Traits> & settings);
+ * @endcode
+ *
+ * Usage example:
+ * @code
+ * using my_server_t = restinio::http_server_t<
+ * 		restinio::default_single_thread_traits_t >;
+ *
+ * restinio::sharded_on_pool_runner_t< my_server_t > runner{
+ * 	std::thread::hardware_concurrency(),
+ * 	[&]( std::size_t shard_index, auto & settings ) {
+ * 		settings
+ * 			.port( 8080 )
+ * 			.address( "localhost" )
+ * 			.request_handler( ... );
+ * 	}
+ * };
+ * runner.start();
+ *
+ * ... // Some application specific code here.
+ *
+ * runner.stop();
+ * runner.wait();
+ * @endcode
+ *
+ * @attention
+ * Port 0 can't be used if there are more than one shard. SO_REUSEPORT
+ * has to be supported by the platform if there are more than one shard.
+ *
+ * @since v.0.7.10
+ */
+template<typename Http_Server>
+class sharded_on_pool_runner_t
+{
+	using traits_t = typename Http_Server::traits_t;
+
+	//! Thread pool with io_context for every thread.
+	impl::ioctx_per_thread_pool_t m_pool;
+
+	//! HTTP-server for every shard.
+	/*!
+	 * @note
+	 * The server with index `i` works on io_context with index `i`.
+	 */
+	std::vector< std::unique_ptr< Http_Server > > m_servers;
+
+	//! Stop io_context of every shard.
+	/*!
+	 * @note
+	 * It's safe to call this method even if m_pool.start() isn't
+	 * completed yet.
+	 */
+	void
+	stop_all_shards() noexcept
+	{
+		for( std::size_t i = 0u; i != m_pool.size(); ++i )
+			m_pool.io_context( i ).stop();
+	}
+
+public :
+	sharded_on_pool_runner_t( const sharded_on_pool_runner_t & ) = delete;
+	sharded_on_pool_runner_t( sharded_on_pool_runner_t && ) = delete;
+
+	//! Initializing constructor.
+	template< typename Shard_Configurator >
+	sharded_on_pool_runner_t(
+		//! Size of thread pool (it's also the number of shards).
+		std::size_t pool_size,
+		//! Configurator for settings of every shard.
+		Shard_Configurator && configurator )
+		:	m_pool{ pool_size }
+	{
+		m_servers.reserve( m_pool.size() );
+		for( std::size_t i = 0u; i != m_pool.size(); ++i )
+		{
+			m_servers.emplace_back(
+				std::make_unique< Http_Server >(
+					restinio::external_io_context( m_pool.io_context( i ) ),
+					impl::sharded_run_details::make_shard_settings< traits_t >(
+						i,
+						m_pool.size(),
+						configurator ) ) );
+		}
+	}
+
+	//! Makes sure all shards are stopped.
+	/*!
+	 * HTTP-servers are closed by their destructors after the stop
+	 * of all shards.
+	 */
+	~sharded_on_pool_runner_t()
+	{
+		if( m_pool.started() )
+		{
+			stop_all_shards();
+			m_pool.wait();
+		}
+	}
+
+	/*!
+	 * @brief Start all shards with callbacks that will be called on
+	 * success or failure.
+	 *
+	 * The @a on_ok should be a function/functor with the format:
+	 * @code
+	 * void () noexcept;
+	 * @endcode
+	 *
+	 * The @a on_error should be a function/functor with the format:
+	 * @code
+	 * void (std::exception_ptr) noexcept;
+	 * @endcode
+	 *
+	 * Only one of callbacks is called and it's called only when
+	 * all shards complete their open_async() operations. If some shard
+	 * fails then @a on_error is called with the first detected exception
+	 * and all shards are stopped.
+	 *
+	 * @attention
+	 * Both callbacks should be noexcept functions/functors. They can be
+	 * called on the context of any shard's thread.
+	 */
+	template<
+		typename On_Ok_Callback,
+		typename On_Error_Callback >
+	void
+	start(
+		//! A callback to be called if all shards started successfully.
+		On_Ok_Callback && on_ok,
+		//! A callback to be called if some shard is not started.
+		On_Error_Callback && on_error )
+	{
+		static_assert( noexcept(on_ok()), "On_Ok_Callback should be noexcept" );
+		static_assert( noexcept(on_error(std::declval<std::exception_ptr>())),
+				"On_Error_Callback should be noexcept" );
+
+		struct start_ctx_t
+		{
+			std::atomic< std::size_t > m_not_completed;
+			std::atomic< bool > m_failed{ false };
+			std::exception_ptr m_first_error;
+
+			std::decay_t< On_Ok_Callback > m_on_ok;
+			std::decay_t< On_Error_Callback > m_on_error;
+
+			start_ctx_t(
+				std::size_t shards,
+				On_Ok_Callback && on_ok,
+				On_Error_Callback && on_error )
+				:	m_not_completed{ shards }
+				,	m_on_ok{ std::forward< On_Ok_Callback >(on_ok) }
+				,	m_on_error{ std::forward< On_Error_Callback >(on_error) }
+			{}
+		};
+
+		auto ctx = std::make_shared< start_ctx_t >(
+				m_servers.size(),
+				std::forward< On_Ok_Callback >(on_ok),
+				std::forward< On_Error_Callback >(on_error) );
+
+		// Should be called by every shard when its open_async completes.
+		auto on_shard_completed = [this, ctx]() noexcept {
+			if( 1u != ctx->m_not_completed.fetch_sub(
+					1u, std::memory_order_acq_rel ) )
+				return;
+
+			if( ctx->m_failed.load( std::memory_order_acquire ) )
+			{
+				// There is no sense to run the pool.
+				stop_all_shards();
+				ctx->m_on_error( ctx->m_first_error );
+			}
+			else
+				ctx->m_on_ok();
+		};
+
+		for( auto & server : m_servers )
+		{
+			server->open_async(
+				[on_shard_completed]() noexcept { on_shard_completed(); },
+				[ctx, on_shard_completed]( std::exception_ptr ex ) noexcept {
+					if( !ctx->m_failed.exchange( true, std::memory_order_acq_rel ) )
+						ctx->m_first_error = std::move(ex);
+
+					on_shard_completed();
+				} );
+		}
+
+		m_pool.start();
+	}
+
+	//! Start all shards.
+	/*!
+	 * It just a shorthand for a version of `start` method with callbacks
+	 * where all callbacks to nothing.
+	 */
+	void
+	start()
+	{
+		this->start(
+				[]() noexcept { /* nothing to do */ },
+				[]( std::exception_ptr ) noexcept { /* nothing to do */ } );
+	}
+
+	//! Are shards started.
+	bool
+	started() const noexcept { return m_pool.started(); }
+
+	//! Stop all shards.
+	/*!
+	 * Calls http_server_t::close_async() for every shard. The io_context
+	 * of a shard is stopped when its HTTP-server is closed. To wait for
+	 * the completion of stop operation the wait() method has to be used.
+	 *
+	 * @tparam Error_CB Type of the callback to be used if an exception
+	 * is thrown inside http_server_t::close_async(). It has the same
+	 * meaning as in on_pool_runner_t::stop(), but it can be called for
+	 * every shard, so it has to be Copyable.
+	 */
+	template< typename Error_CB = abort_app_in_error_callback_t >
+	void
+	stop( Error_CB error_cb = Error_CB{} ) noexcept
+	{
+		for( std::size_t i = 0u; i != m_servers.size(); ++i )
+		{
+			auto * ioctx = &(m_pool.io_context( i ));
+
+			m_servers[ i ]->close_async(
+				[ioctx]() noexcept {
+					// Stop running io_context of that shard.
+					ioctx->stop();
+				},
+				[ioctx, callback = error_cb]( std::exception_ptr ex ) noexcept {
+					// Stop running io_context anyway.
+					ioctx->stop();
+
+					// We have to call error_cb in this case.
+					callback( std::move(ex) );
+				} );
+		}
+	}
+
+	//! Wait for full stop of all shards.
+	void
+	wait() noexcept { m_pool.wait(); }
+
+	//! Get the number of shards.
+	[[nodiscard]]
+	std::size_t
+	shards_count() const noexcept { return m_servers.size(); }
+
+	//! Get HTTP-server of the specified shard.
+	[[nodiscard]]
+	Http_Server &
+	server( std::size_t shard_index ) const noexcept
+	{
+		return *(m_servers[ shard_index ]);
+	}
+};
+
+//
+// run_on_thread_pool_shards_t
+//
+/*!
+ * @brief Helper type for holding parameters necessary for running
+ * HTTP-server in shard-per-thread mode.
+ *
+ * @note This class is not intended for direct use. It is used by
+ * RESTinio itself.
+ *
+ * @since v.0.7.10
+ */
+template< typename Traits, typename Shard_Configurator >
+class run_on_thread_pool_shards_t
+{
+	//! Size of thread pool (it's also the number of shards).
+	std::size_t m_pool_size;
+	//! Configurator for settings of every shard.
+	Shard_Configurator m_configurator;
+
+public:
+	//! Initializing constructor.
+	run_on_thread_pool_shards_t(
+		std::size_t pool_size,
+		Shard_Configurator configurator )
+		:	m_pool_size{ pool_size }
+		,	m_configurator{ std::move(configurator) }
+	{}
+
+	std::size_t
+	pool_size() const noexcept { return m_pool_size; }
+
+	Shard_Configurator &
+	configurator() noexcept { return m_configurator; }
+};
+
+/*!
+ * @brief A special marker for the case when http_server must be
+ * run in shard-per-thread mode.
+ *
+ * Every thread of the pool gets its own io_context and its own
+ * HTTP-server instance with SO_REUSEPORT acceptor.
+ * See sharded_on_pool_runner_t for more details.
+ *
+ * Usage example:
+ * @code
+ * // run() returns if Ctrl+C is pressed.
+ * restinio::run( restinio::on_thread_pool_shards(
+ * 	std::thread::hardware_concurrency(),
+ * 	[]( std::size_t shard_index, auto & settings ) {
+ * 		settings
+ * 			.port( 8080 )
+ * 			.address( "localhost" )
+ * 			.request_handler( ... );
+ * 	} ) );
+ * @endcode
+ *
+ * @since v.0.7.10
+ */
+template<
+	typename Traits = default_single_thread_traits_t,
+	typename Shard_Configurator >
+run_on_thread_pool_shards_t< Traits, std::decay_t< Shard_Configurator > >
+on_thread_pool_shards(
+	//! Size of the pool.
+	std::size_t pool_size,
+	//! Configurator for settings of every shard.
+	Shard_Configurator && configurator )
+{
+	return { pool_size, std::forward< Shard_Configurator >(configurator) };
+}
+
+//! Helper function for running http server in shard-per-thread mode
+//! until ctrl+c is hit.
+/*!
+ * Usage example:
+ * \code
+ * restinio::run(
+ * 		restinio::on_thread_pool_shards<my_traits>(4,
+ * 			[](std::size_t, auto & settings) {
+ * 				settings.port(8080)
+ * 					.address("localhost")
+ * 					.request_handler([](auto req) {...});
+ * 			}) );
+ * \endcode
+ *
+ * @since v.0.7.10
+ */
+template< typename Traits, typename Shard_Configurator >
+inline void
+run( run_on_thread_pool_shards_t< Traits, Shard_Configurator > && params )
+{
+	sharded_on_pool_runner_t< http_server_t< Traits > > runner{
+			params.pool_size(),
+			params.configurator() };
+
+	// Errors can be reported on the context of different shards.
+	std::mutex exception_lock;
+	std::exception_ptr exception_caught;
+	const auto store_exception =
+		[&exception_lock, &exception_caught]( std::exception_ptr ex ) noexcept {
+			std::lock_guard< std::mutex > lock{ exception_lock };
+			if( !exception_caught )
+				exception_caught = std::move(ex);
+		};
+
+	asio_ns::signal_set break_signals{
+			runner.server( 0u ).io_context(),
+			RESTINIO_DEFAULT_BREAK_SIGNALS_LIST
+		};
+	break_signals.async_wait(
+		[&]( const asio_ns::error_code & ec, int ){
+			if( !ec )
+			{
+				runner.stop( store_exception );
+			}
+		} );
+
+	runner.start(
+		[]() noexcept { /* Ok. */},
+		store_exception );
+
+	runner.wait();
+
+	// If an error was detected it should be propagated.
+	if( exception_caught )
+		std::rethrow_exception( exception_caught );
+}
+
 // Forward declaration.
 // It's necessary for running_server_handle_t.
 template< typename Http_Server >
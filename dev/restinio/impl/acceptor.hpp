@@ -9,6 +9,13 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+
+#if defined(__linux__)
+	#include <sys/socket.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
 
 #include <restinio/connection_count_limiter.hpp>
 
@@ -151,6 +158,47 @@ struct ip_blocker_holder_t< restinio::ip_blocker::noop_ip_blocker_t >
 	}
 };
 
+/*!
+ * @brief Try to accept a connection without blocking.
+ *
+ * On Linux `accept4(SOCK_NONBLOCK|SOCK_CLOEXEC)` is used, so there is
+ * no need for additional system calls for switching the new socket
+ * to non-blocking mode. On other platforms asio's accept() is used.
+ *
+ * @attention
+ * The @a acceptor has to be in non-blocking mode.
+ *
+ * @since v.0.7.10
+ */
+inline void
+accept_nonblocking(
+	asio_ns::ip::tcp::acceptor & acceptor,
+	//! Protocol for the new socket.
+	const asio_ns::ip::tcp & protocol,
+	asio_ns::ip::tcp::socket & socket,
+	asio_ns::error_code & ec )
+{
+#if defined(__linux__)
+	const int fd = ::accept4(
+			acceptor.native_handle(),
+			nullptr,
+			nullptr,
+			SOCK_NONBLOCK | SOCK_CLOEXEC );
+	if( fd < 0 )
+	{
+		ec = asio_ns::error_code{ errno, asio_ns::error::get_system_category() };
+		return;
+	}
+
+	socket.assign( protocol, fd, ec );
+	if( ec )
+		::close( fd );
+#else
+	(void)protocol;
+	acceptor.accept( socket, ec );
+#endif
+}
+
 } /* namespace acceptor_details */
 
 //
@@ -202,6 +250,7 @@ class acceptor_t final
 			,	m_executor{ io_context.get_executor() }
 			,	m_open_close_operations_executor{ io_context.get_executor() }
 			,	m_separate_accept_and_create_connect{ settings.separate_accept_and_create_connect() }
+			,	m_accept_batch_size{ settings.accept_batch_size() }
 			,	m_connection_factory{ std::move( connection_factory ) }
 			,	m_logger{ logger }
 			,	m_connection_count_limiter{
@@ -265,6 +314,11 @@ class acceptor_t final
 				// Now we can switch acceptor to listen state.
 				m_acceptor.listen( asio_ns::socket_base::max_listen_connections );
 
+				// Since v.0.7.10 the acceptor should be in non-blocking mode
+				// if the listen backlog is drained by non-blocking accepts.
+				if( batch_accept_enabled() )
+					m_acceptor.non_blocking( true );
+
 				// Call accept connections routine.
 				for( std::size_t i = 0; i< this->concurrent_accept_sockets_count(); ++i )
 				{
@@ -414,6 +468,11 @@ class acceptor_t final
 						[this, i] {
 							accept_connection_for_socket_with_index( i );
 						} );
+
+				// Since v.0.7.10 there can be more connections in
+				// the listen backlog that can be accepted right now.
+				if( batch_accept_enabled() )
+					drain_listen_backlog( i );
 			}
 			else
 			{
@@ -445,8 +504,32 @@ class acceptor_t final
 			//! socket index in the pool of sockets.
 			std::size_t i )
 		{
-			auto incoming_socket = this->move_socket( i );
+			bool passed_to_connection = false;
+			handle_accepted_socket(
+					this->move_socket( i ), i, passed_to_connection );
+		}
 
+		/*!
+		 * @brief Performs actual actions for a socket of a new connection.
+		 *
+		 * @note
+		 * This method can throw. @a passed_to_connection is set before
+		 * an exception if the socket was already passed to connection's
+		 * creation.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		handle_accepted_socket(
+			stream_socket_t incoming_socket,
+			//! socket index in the pool of sockets (is used for logging).
+			std::size_t i,
+			//! Set to true when the socket is passed to connection's
+			//! creation (the reservation of a connection slot is taken
+			//! by a connection_lifetime_monitor_t since that moment).
+			//! It remains false if the connection is denied by IP-blocker.
+			bool & passed_to_connection )
+		{
 			auto remote_endpoint =
 					incoming_socket.lowest_layer().remote_endpoint();
 
@@ -482,15 +565,109 @@ class acceptor_t final
 				// Acception of the connection can be continued.
 				do_accept_current_connection(
 						std::move(incoming_socket),
-						remote_endpoint );
+						remote_endpoint,
+						passed_to_connection );
 			break;
 			}
 		}
 
+		//! Is batch accept enabled and supported by the socket type?
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		batch_accept_enabled() const noexcept
+		{
+			if constexpr( std::is_same_v< stream_socket_t, asio_ns::ip::tcp::socket > )
+				return 0u != m_accept_batch_size;
+			else
+				return false;
+		}
+
+		//! Accept connections from the listen backlog by non-blocking calls.
+		/*!
+		 * Up to m_accept_batch_size connections are accepted. The process
+		 * stops when there are no more pending connections in the backlog
+		 * or when the limit of parallel connections is reached.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		drain_listen_backlog(
+			//! socket index in the pool of sockets (is used for logging).
+			std::size_t i ) noexcept
+		{
+			if constexpr( std::is_same_v< stream_socket_t, asio_ns::ip::tcp::socket > )
+			{
+				for( std::size_t n = 0u; n != m_accept_batch_size; ++n )
+				{
+					if( !m_connection_count_limiter.try_reserve_extra_accept() )
+						break;
+
+					asio_ns::error_code ec;
+					stream_socket_t incoming_socket{ m_acceptor.get_executor() };
+					acceptor_details::accept_nonblocking(
+							m_acceptor, m_protocol, incoming_socket, ec );
+
+					if( ec )
+					{
+						m_connection_count_limiter.cancel_extra_accept();
+
+						// A connection can be reset by the client while
+						// it's in the backlog, it isn't an error of the server.
+						// There can be other connections in the backlog.
+						if( asio_ns::error::connection_aborted == ec )
+							continue;
+
+						if( asio_ns::error::would_block != ec &&
+								asio_ns::error::try_again != ec )
+						{
+							restinio::utils::log_error_noexcept( m_logger,
+								[&]{
+									return fmt::format(
+										RESTINIO_FMT_FORMAT_STRING(
+											"failed to accept connection in batch "
+											"on socket #{}: {}" ),
+										i,
+										ec.message() );
+								} );
+						}
+
+						break;
+					}
+
+					bool passed_to_connection = false;
+					restinio::utils::suppress_exceptions(
+							m_logger,
+							"drain_listen_backlog",
+							[&] {
+								handle_accepted_socket(
+										std::move( incoming_socket ),
+										i,
+										passed_to_connection );
+							} );
+
+					// The reservation has to be cancelled if it wasn't
+					// taken by a connection_lifetime_monitor_t (even if
+					// there was an exception after that).
+					if( !passed_to_connection )
+						m_connection_count_limiter.cancel_extra_accept();
+				}
+			}
+			else
+			{
+				(void)i;
+			}
+		}
+
 		void
 		do_accept_current_connection(
 			stream_socket_t incoming_socket,
-			endpoint_t remote_endpoint )
+			endpoint_t remote_endpoint,
+			//! Is set to true when the connection_lifetime_monitor_t
+			//! is created (since v.0.7.10).
+			bool & passed_to_connection )
 		{
 			auto create_and_init_connection =
 				[sock = std::move(incoming_socket),
@@ -521,6 +698,10 @@ class acceptor_t final
 							} );
 				};
 
+			// The lifetime monitor is created by now. It will release
+			// the connection slot even if there is an exception below.
+			passed_to_connection = true;
+
 			if( m_separate_accept_and_create_connect )
 			{
 				asio_ns::post(
@@ -585,6 +766,13 @@ class acceptor_t final
 		//! Do separate an accept operation and connection instantiation.
 		const bool m_separate_accept_and_create_connect;
 
+		/*!
+		 * @brief Max count of connections to be accepted in a batch.
+		 *
+		 * @since v.0.7.10
+		 */
+		const std::size_t m_accept_batch_size;
+
 		//! Factory for creating connections.
 		connection_factory_shared_ptr_t m_connection_factory;
 
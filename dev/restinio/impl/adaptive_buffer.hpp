@@ -0,0 +1,218 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Input buffer that changes its size depending on the load.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/asio_include.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace restinio
+{
+
+namespace impl
+{
+
+//
+// adaptive_buffer_t
+//
+
+/*!
+ * @brief Helper class for reading bytes and feeding them to parser.
+ *
+ * It's similar to fixed_buffer_t but the size of the buffer isn't
+ * fixed. The buffer starts with the minimal size and grows (twice at
+ * a time, up to the maximal size) if a read operation fills the whole
+ * buffer. It means that a client sends a big body or a burst of pipelined
+ * requests and bigger reads will be more efficient.
+ *
+ * The buffer shrinks (twice at a time, down to the minimal size) if
+ * several consecutive read operations use less than a quarter of
+ * the buffer.
+ *
+ * The size is changed only before the next read operation, when there is
+ * no unconsumed data in the buffer.
+ *
+ * If the minimal size is equal to the maximal size then the buffer
+ * behaves just like fixed_buffer_t.
+ *
+ * @since v.0.7.10
+ */
+class adaptive_buffer_t
+{
+	public:
+		adaptive_buffer_t( const adaptive_buffer_t & ) = delete;
+		adaptive_buffer_t & operator = ( const adaptive_buffer_t & ) = delete;
+		adaptive_buffer_t( adaptive_buffer_t && ) = delete;
+		adaptive_buffer_t & operator = ( adaptive_buffer_t && ) = delete;
+
+		//! How many consecutive underused reads lead to shrinking.
+		static constexpr unsigned int underused_reads_to_shrink = 4u;
+
+		adaptive_buffer_t(
+			//! Storage to be reused (can be empty).
+			std::vector< char > storage,
+			//! Minimal (and initial) size of the buffer.
+			std::size_t min_size,
+			//! Maximal size of the buffer.
+			std::size_t max_size )
+			:	m_buf{ std::move( storage ) }
+			,	m_min_size{ std::min( min_size, max_size ) }
+			,	m_max_size{ max_size }
+			,	m_desired_size{ m_min_size }
+		{
+			// NOTE: the capacity of the reused storage is preserved,
+			// so it can be used for growth without reallocation.
+			m_buf.resize( m_min_size );
+		}
+
+		//! Make asio buffer for reading bytes from socket.
+		/*!
+		 * @note
+		 * Can throw because the buffer can be resized here.
+		 */
+		auto
+		make_asio_buffer()
+		{
+			if( m_desired_size != m_buf.size() && 0u == m_ready_length )
+				resize_storage();
+
+			return asio_ns::buffer( m_buf.data(), m_buf.size() );
+		}
+
+		//! Mark how many bytes were obtained.
+		void
+		obtained_bytes( std::size_t length ) noexcept
+		{
+			m_ready_length = length; // Current bytes in buffer.
+			m_ready_pos = 0; // Reset current pos.
+
+			adjust_desired_size( length );
+		}
+
+		//! Mark how many bytes were consumed.
+		void
+		consumed_bytes( std::size_t length ) noexcept
+		{
+			m_ready_length -= length; // decrement buffer length.
+			m_ready_pos += length; // Shift current pos.
+		}
+
+		//! How many unconsumed bytes are there in buffer.
+		std::size_t length() const noexcept { return m_ready_length; }
+
+		//! Get pointer to unconsumed bytes.
+		/*!
+			\note To check that buffer has unconsumed bytes use length().
+		*/
+		const char * bytes() const noexcept { return m_buf.data() + m_ready_pos; }
+
+		//! The current size of the buffer.
+		std::size_t size() const noexcept { return m_buf.size(); }
+
+		/*!
+		 * @brief Take the underlying storage out of the buffer.
+		 *
+		 * Buffer becomes empty after that and can't be used until
+		 * a new storage is set by reuse_storage().
+		 */
+		std::vector< char >
+		giveaway_storage() noexcept
+		{
+			m_ready_pos = 0;
+			m_ready_length = 0;
+			return std::move( m_buf );
+		}
+
+		//! Set a new storage for the buffer.
+		/*!
+		 * Is intended to be used after giveaway_storage() for a buffer
+		 * that should be used again.
+		 *
+		 * @note
+		 * The storage is resized to the current size of the buffer.
+		 */
+		void
+		reuse_storage( std::vector< char > storage )
+		{
+			m_buf = std::move( storage );
+			m_buf.resize( m_desired_size );
+		}
+
+	private:
+		//! Buffer for io operation.
+		std::vector< char > m_buf;
+
+		//! unconsumed data left in buffer:
+		//! \{
+		//! Start of data in buffer.
+		std::size_t m_ready_pos{0};
+
+		//! Data size.
+		std::size_t m_ready_length{0};
+		//! \}
+
+		const std::size_t m_min_size;
+		const std::size_t m_max_size;
+
+		//! The size to be used for the next read operation.
+		std::size_t m_desired_size;
+
+		//! Count of consecutive reads that used less than a quarter
+		//! of the buffer.
+		unsigned int m_underused_reads{ 0u };
+
+		void
+		adjust_desired_size( std::size_t length ) noexcept
+		{
+			const auto current_size = m_buf.size();
+
+			if( length == current_size )
+			{
+				m_underused_reads = 0u;
+				if( current_size < m_max_size )
+					m_desired_size = std::min( current_size * 2u, m_max_size );
+			}
+			else if( length <= current_size / 4u && current_size > m_min_size )
+			{
+				if( ++m_underused_reads == underused_reads_to_shrink )
+				{
+					m_underused_reads = 0u;
+					m_desired_size = std::max( current_size / 2u, m_min_size );
+				}
+			}
+			else
+				m_underused_reads = 0u;
+		}
+
+		void
+		resize_storage()
+		{
+			const bool shrinking = m_desired_size < m_buf.size();
+
+			if( m_desired_size > m_buf.capacity() ||
+					( shrinking && m_desired_size * 2u <= m_buf.capacity() ) )
+			{
+				// A new storage is necessary (in the case of shrinking the
+				// memory has to be actually released). There is no need to
+				// preserve the content because there is no unconsumed data.
+				std::vector< char > new_storage( m_desired_size );
+				m_buf.swap( new_storage );
+			}
+			else
+				m_buf.resize( m_desired_size );
+		}
+};
+
+} /* namespace impl */
+
+} /* namespace restinio */
@@ -17,12 +17,14 @@
 #include <restinio/exception.hpp>
 #include <restinio/http_headers.hpp>
 #include <restinio/request_handler.hpp>
+#include <restinio/request_allocator.hpp>
 #include <restinio/connection_count_limiter.hpp>
+#include <restinio/timer_common.hpp>
 #include <restinio/impl/connection_base.hpp>
 #include <restinio/impl/header_helpers.hpp>
 #include <restinio/impl/response_coordinator.hpp>
 #include <restinio/impl/connection_settings.hpp>
-#include <restinio/impl/fixed_buffer.hpp>
+#include <restinio/impl/adaptive_buffer.hpp>
 #include <restinio/impl/write_group_output_ctx.hpp>
 #include <restinio/impl/executor_wrapper.hpp>
 #include <restinio/impl/sendfile_operation.hpp>
@@ -30,12 +32,96 @@
 #include <restinio/utils/impl/safe_uint_truncate.hpp>
 #include <restinio/utils/at_scope_exit.hpp>
 
+#include <atomic>
+
 namespace restinio
 {
 
 namespace impl
 {
 
+//
+// input_span_accumulator_t
+//
+
+/*!
+ * @brief Accumulator for a part of incoming message (like a name or
+ * a value of HTTP-field) that is received from the parser.
+ *
+ * If the whole part is received at once then only a view to the input
+ * buffer is stored and no copy is made. The content is copied into
+ * the own storage only if the part is received in several pieces
+ * (e.g. it spans two reads from the socket) or if the input buffer
+ * is going to be reused (see detach_from_input_buffer()).
+ *
+ * @since v.0.7.10
+ */
+class input_span_accumulator_t
+{
+	public:
+		//! Append the next piece of data.
+		void
+		append( const char * at, std::size_t length )
+		{
+			if( m_storage.empty() && m_view.empty() )
+			{
+				m_view = string_view_t{ at, length };
+			}
+			else
+			{
+				detach_from_input_buffer();
+				m_storage.append( at, length );
+			}
+		}
+
+		//! Copy the data into the own storage if it's necessary.
+		/*!
+		 * Should be called before the input buffer will be reused.
+		 */
+		void
+		detach_from_input_buffer()
+		{
+			if( !m_view.empty() )
+			{
+				m_storage.assign( m_view.data(), m_view.size() );
+				m_view = string_view_t{};
+			}
+		}
+
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept
+		{
+			return m_view.empty() ? m_storage.size() : m_view.size();
+		}
+
+		//! Get the accumulated data.
+		/*!
+		 * @attention
+		 * The value returned is valid until the next call to
+		 * append(), detach_from_input_buffer() or clear().
+		 */
+		[[nodiscard]]
+		string_view_t
+		view() const noexcept
+		{
+			return m_view.empty() ? string_view_t{ m_storage } : m_view;
+		}
+
+		void
+		clear() noexcept
+		{
+			m_view = string_view_t{};
+			m_storage.clear();
+		}
+
+	private:
+		//! A view to the input buffer.
+		string_view_t m_view;
+		//! The own storage for data received in several pieces.
+		std::string m_storage;
+};
+
 //
 // http_parser_ctx_t
 //
@@ -51,6 +137,13 @@ struct http_parser_ctx_t
 	//! \{
 	http_request_header_t m_header;
 	std::string m_body;
+
+	/*!
+	 * @brief The body if it's stored as a rope.
+	 *
+	 * @since v.0.7.10
+	 */
+	body_rope_t m_body_rope;
 	//! \}
 
 	//! Parser context temp values and flags.
@@ -58,6 +151,20 @@ struct http_parser_ctx_t
 	std::string m_current_field_name;
 	std::size_t m_last_value_total_size{ 0u };
 
+	/*!
+	 * @brief The name and the value of the current HTTP-field.
+	 *
+	 * An HTTP-field is added to the header only when its value is
+	 * completed, so the name and the value are copied only once into
+	 * the final storage.
+	 *
+	 * @since v.0.7.10
+	 */
+	//! \{
+	input_span_accumulator_t m_current_header_field_name;
+	input_span_accumulator_t m_current_header_field_value;
+	//! \}
+
 	/*!
 	 * @since v.0.6.9
 	 */
@@ -104,6 +211,13 @@ struct http_parser_ctx_t
 	 */
 	const incoming_http_msg_limits_t m_limits;
 
+	/*!
+	 * @brief Should the body be stored in m_body_rope instead of m_body?
+	 *
+	 * @since v.0.7.10
+	 */
+	const bool m_body_as_rope{ false };
+
 	/*!
 	 * @brief The main constructor.
 	 *
@@ -114,20 +228,88 @@ struct http_parser_ctx_t
 		:	m_limits{ limits }
 	{}
 
+	/*!
+	 * @brief Constructor for the case when the body is stored as a rope.
+	 *
+	 * @since v.0.7.10
+	 */
+	http_parser_ctx_t(
+		incoming_http_msg_limits_t limits,
+		std::size_t body_rope_segment_capacity )
+		:	m_body_rope{ body_rope_segment_capacity }
+		,	m_limits{ limits }
+		,	m_body_as_rope{ true }
+	{}
+
+	//! The size of the body received so far.
+	/*!
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	std::size_t
+	body_size() const noexcept
+	{
+		return m_body_as_rope ? m_body_rope.size() : m_body.size();
+	}
+
+	//! Prepare the storage for the body of the specified size.
+	/*!
+	 * @since v.0.7.10
+	 */
+	void
+	expect_body( std::size_t size )
+	{
+		if( m_body_as_rope )
+			m_body_rope.expected_size( size );
+		else
+			m_body.reserve( size );
+	}
+
+	//! Append the next piece of the body.
+	/*!
+	 * @since v.0.7.10
+	 */
+	void
+	append_body( const char * at, std::size_t length )
+	{
+		if( m_body_as_rope )
+			m_body_rope.append( at, length );
+		else
+			m_body.append( at, length );
+	}
+
 	//! Prepare context to handle new request.
 	void
 	reset()
 	{
 		m_header = http_request_header_t{};
 		m_body.clear();
+		m_body_rope.clear();
 		m_current_field_name.clear();
 		m_last_value_total_size = 0u;
+		m_current_header_field_name.clear();
+		m_current_header_field_value.clear();
 		m_leading_headers_completed = false;
 		m_bytes_parsed = 0;
 		m_message_complete = false;
 		m_total_field_count = 0u;
 	}
 
+	//! Copy data that points to the input buffer into own storage.
+	/*!
+	 * Must be called when the parser finished the processing of the
+	 * current content of the input buffer, because the buffer will be
+	 * reused for the next read.
+	 *
+	 * @since v.0.7.10
+	 */
+	void
+	detach_from_input_buffer()
+	{
+		m_current_header_field_name.detach_from_input_buffer();
+		m_current_header_field_value.detach_from_input_buffer();
+	}
+
 	//! Creates an instance of chunked_input_info if there is an info
 	//! about chunks in the body.
 	/*!
@@ -269,11 +451,21 @@ enum class connection_upgrade_stage_t : std::uint8_t
 struct connection_input_t
 {
 	connection_input_t(
-		std::size_t buffer_size,
+		std::size_t initial_buffer_size,
+		std::size_t max_buffer_size,
 		incoming_http_msg_limits_t limits,
-		const llhttp_settings_t* settings )
-		:	m_parser_ctx{ limits }
-		,	m_buf{ buffer_size }
+		const llhttp_settings_t* settings,
+		//! Storage to be reused for the input buffer (can be empty).
+		std::vector< char > buffer_storage = {},
+		//! Should the body be stored as a rope?
+		bool body_as_rope = false,
+		//! Capacity of a segment of the rope.
+		std::size_t body_rope_segment_capacity =
+			body_rope_t::default_segment_capacity )
+		:	m_parser_ctx{ body_as_rope ?
+				http_parser_ctx_t{ limits, body_rope_segment_capacity } :
+				http_parser_ctx_t{ limits } }
+		,	m_buf{ std::move( buffer_storage ), initial_buffer_size, max_buffer_size }
 	{
 		llhttp_init( &m_parser, llhttp_type_t::HTTP_REQUEST, settings );
 		m_parser.data = &m_parser_ctx;
@@ -286,7 +478,11 @@ struct connection_input_t
 	//! \}
 
 	//! Input buffer.
-	fixed_buffer_t m_buf;
+	/*!
+	 * @note
+	 * Since v.0.7.10 it's adaptive_buffer_t instead of fixed_buffer_t.
+	 */
+	adaptive_buffer_t m_buf;
 
 	//! Connection upgrade request stage.
 	connection_upgrade_stage_t m_connection_upgrade_stage{
@@ -375,15 +571,19 @@ class connection_t final
 			endpoint_t remote_endpoint,
 			//! Lifetime monitor to be used for handling connection count.
 			lifetime_monitor_t lifetime_monitor )
-			:	connection_base_t{ conn_id }
+			:	connection_base_t{ conn_id, settings->m_auto_date_field }
 			,	executor_wrapper_base_t{ socket.get_executor() }
 			,	m_socket{ std::move( socket ) }
 			,	m_settings{ std::move( settings ) }
 			,	m_remote_endpoint{ std::move( remote_endpoint ) }
 			,	m_input{
+					m_settings->m_initial_buffer_size,
 					m_settings->m_buffer_size,
 					m_settings->m_incoming_http_msg_limits,
-					&m_settings->m_parser_settings
+					&m_settings->m_parser_settings,
+					acquire_input_buffer_storage( *m_settings ),
+					m_settings->m_request_body_as_rope,
+					m_settings->m_request_body_rope_segment_capacity
 				}
 			,	m_response_coordinator{ m_settings->m_max_pipelined_requests }
 			,	m_timer_guard{ m_settings->create_timer_guard() }
@@ -416,6 +616,9 @@ class connection_t final
 							"[connection:{}] destructor called" ),
 						connection_id() );
 				} );
+
+			// Input buffer can be reused by another connection.
+			release_input_buffer_storage();
 		}
 
 		void
@@ -527,6 +730,12 @@ class connection_t final
 		{
 			if( !m_input.m_read_operation_is_running )
 			{
+				if( should_release_input_buffer() )
+				{
+					wait_for_socket_readiness();
+					return;
+				}
+
 				m_logger.trace( [&]{
 					return fmt::format(
 							RESTINIO_FMT_FORMAT_STRING(
@@ -534,19 +743,7 @@ class connection_t final
 							connection_id() );
 				} );
 
-
-				m_input.m_read_operation_is_running = true;
-				m_socket.async_read_some(
-					m_input.m_buf.make_asio_buffer(),
-					asio_ns::bind_executor(
-						this->get_executor(),
-						[this, ctx = shared_from_this()]
-						// NOTE: this lambda is noexcept since v.0.6.0.
-						( const asio_ns::error_code & ec,
-							std::size_t length ) noexcept {
-							m_input.m_read_operation_is_running = false;
-							RESTINIO_ENSURE_NOEXCEPT_CALL( after_read( ec, length ) );
-						} ) );
+				start_read();
 			}
 			else
 			{
@@ -559,6 +756,125 @@ class connection_t final
 			}
 		}
 
+		//! Initiate a read operation.
+		/*!
+		 * @since v.0.7.10
+		 */
+		void
+		start_read()
+		{
+			m_input.m_read_operation_is_running = true;
+			m_socket.async_read_some(
+				m_input.m_buf.make_asio_buffer(),
+				asio_ns::bind_executor(
+					this->get_executor(),
+					[this, ctx = shared_from_this()]
+					// NOTE: this lambda is noexcept since v.0.6.0.
+					( const asio_ns::error_code & ec,
+						std::size_t length ) noexcept {
+						m_input.m_read_operation_is_running = false;
+						RESTINIO_ENSURE_NOEXCEPT_CALL( after_read( ec, length ) );
+					} ) );
+		}
+
+		//! Can the input buffer be released while waiting for a new request?
+		/*!
+		 * It's possible only if the corresponding mode is turned on,
+		 * the socket supports waiting for readiness, there is no
+		 * unconsumed data in the buffer and the next request isn't
+		 * started yet.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		should_release_input_buffer() const noexcept
+		{
+			if constexpr( std::is_base_of_v< asio_ns::socket_base, stream_socket_t > )
+			{
+				return m_settings->m_release_idle_input_buffer &&
+						0u == m_input.m_parser_ctx.m_bytes_parsed &&
+						0u == m_input.m_buf.length();
+			}
+			else
+				return false;
+		}
+
+		//! Release the input buffer and wait until there is some data to read.
+		/*!
+		 * The input buffer is acquired again (from the connection pool if it's
+		 * used) when the socket becomes readable.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		wait_for_socket_readiness()
+		{
+			m_logger.trace( [&]{
+				return fmt::format(
+						RESTINIO_FMT_FORMAT_STRING(
+							"[connection:{}] release input buffer and "
+							"wait for incoming data" ),
+						connection_id() );
+			} );
+
+			release_input_buffer_storage();
+
+			m_input.m_read_operation_is_running = true;
+			m_socket.async_wait(
+				asio_ns::socket_base::wait_read,
+				asio_ns::bind_executor(
+					this->get_executor(),
+					[this, ctx = shared_from_this()]
+					( const asio_ns::error_code & ec ) noexcept {
+						m_input.m_read_operation_is_running = false;
+						RESTINIO_ENSURE_NOEXCEPT_CALL( after_socket_readiness( ec ) );
+					} ) );
+		}
+
+		//! Handle the result of waiting for readiness of the socket.
+		/*!
+		 * @since v.0.7.10
+		 */
+		void
+		after_socket_readiness( const asio_ns::error_code & ec ) noexcept
+		{
+			if( ec )
+			{
+				// The error will be handled the same way as an error
+				// of an ordinary read operation.
+				after_read( ec, 0u );
+				return;
+			}
+
+			try
+			{
+				m_input.m_buf.reuse_storage(
+						acquire_input_buffer_storage( *m_settings ) );
+
+				m_logger.trace( [&]{
+					return fmt::format(
+							RESTINIO_FMT_FORMAT_STRING(
+								"[connection:{}] incoming data is ready, "
+								"start reading request" ),
+							connection_id() );
+				} );
+
+				start_read();
+			}
+			catch( const std::exception & x )
+			{
+				trigger_error_and_close( [&] {
+						return fmt::format(
+								RESTINIO_FMT_FORMAT_STRING(
+									"[connection:{}] unable to start reading "
+									"after waiting for incoming data: {}" ),
+								connection_id(),
+								x.what() );
+					} );
+			}
+		}
+
 		//! Handle read operation result.
 		inline void
 		after_read( const asio_ns::error_code & ec, std::size_t length ) noexcept
@@ -667,6 +983,11 @@ class connection_t final
 
 			m_input.m_parser_ctx.m_bytes_parsed += nparsed;
 
+			// The content of the buffer will be replaced by the next read,
+			// so all partially received parts of the message have to be
+			// copied.
+			m_input.m_parser_ctx.detach_from_input_buffer();
+
 			// If entire http-message was obtained,
 			// parser is stopped and the might be a part of consecutive request
 			// left in buffer, so we mark how many bytes were obtained.
@@ -753,16 +1074,11 @@ class connection_t final
 					// so it is possible to omit this timer scheduling.
 					guard_request_handling_operation();
 
+					// Since v.0.7.10 a response can be taken from the cache.
 					const auto handling_result =
-						m_request_handler(
-							std::make_shared< generic_request_t >(
-								request_id,
-								std::move( parser_ctx.m_header ),
-								std::move( parser_ctx.m_body ),
-								parser_ctx.make_chunked_input_info_if_necessary(),
-								shared_from_concrete< connection_base_t >(),
-								m_remote_endpoint,
-								m_settings->extra_data_factory() ) );
+						try_write_cached_response( request_id ) ?
+							request_accepted() :
+							m_request_handler( make_request( request_id ) );
 
 					switch( handling_result )
 					{
@@ -844,6 +1160,68 @@ class connection_t final
 			}
 		}
 
+		//! Write a response from the response cache (if it's found).
+		/*!
+		 * @return true if the response is found.
+		 *
+		 * @since v.0.7.10
+		 */
+		bool
+		try_write_cached_response( request_id_t request_id )
+		{
+			if( !m_settings->m_response_cache )
+				return false;
+
+			const auto & header = m_input.m_parser_ctx.m_header;
+			const auto response = m_settings->m_response_cache->find( header );
+			if( !response )
+				return false;
+
+			m_logger.trace( [&]{
+				return fmt::format(
+						RESTINIO_FMT_FORMAT_STRING(
+							"[connection:{}] response (#{}) is taken from the cache" ),
+						connection_id(),
+						request_id );
+			} );
+
+			const auto connection_attr =
+				response_connection_attr( header.should_keep_alive() );
+
+			write_response_parts_impl(
+				request_id,
+				response_output_flags_t{
+					response_parts_attr_t::final_parts,
+					connection_attr },
+				response->make_write_group( connection_attr ) );
+
+			return true;
+		}
+
+		//! Create a request object from the data in input context (m_input).
+		/*!
+		 * Request object is created via request allocator from Traits.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		std::shared_ptr< generic_request_t >
+		make_request( request_id_t request_id )
+		{
+			auto & parser_ctx = m_input.m_parser_ctx;
+
+			return std::allocate_shared< generic_request_t >(
+				m_request_allocator.template make_allocator< generic_request_t >(),
+				request_id,
+				std::move( parser_ctx.m_header ),
+				std::move( parser_ctx.m_body ),
+				std::move( parser_ctx.m_body_rope ),
+				parser_ctx.make_chunked_input_info_if_necessary(),
+				shared_from_concrete< connection_base_t >(),
+				m_remote_endpoint,
+				m_settings->extra_data_factory() );
+		}
+
 		//! Calls handler for upgrade request.
 		/*!
 			Request data must be in input context (m_input).
@@ -879,15 +1257,8 @@ class connection_t final
 			m_input.m_connection_upgrade_stage =
 				connection_upgrade_stage_t::wait_for_upgrade_handling_result_or_nothing;
 
-			const auto handling_result = m_request_handler(
-				std::make_shared< generic_request_t >(
-					request_id,
-					std::move( parser_ctx.m_header ),
-					std::move( parser_ctx.m_body ),
-					parser_ctx.make_chunked_input_info_if_necessary(),
-					shared_from_concrete< connection_base_t >(),
-					m_remote_endpoint,
-					m_settings->extra_data_factory() ) );
+			const auto handling_result =
+				m_request_handler( make_request( request_id ) );
 			switch( handling_result )
 			{
 				case request_handling_status_t::not_handled:
@@ -948,6 +1319,10 @@ class connection_t final
 			//! Part of the response data.
 			write_group_t wg ) override
 		{
+			// Data is counted as queued just now because the producer
+			// can check the state of the connection from its own thread.
+			account_queued_output( wg );
+
 			//! Run write message on io_context loop if possible.
 			asio_ns::dispatch(
 				this->get_executor(),
@@ -961,7 +1336,7 @@ class connection_t final
 					{
 						try
 						{
-							write_response_parts_impl(
+							append_response_parts(
 								request_id,
 								response_output_flags,
 								std::move( actual_wg ) );
@@ -980,6 +1355,10 @@ class connection_t final
 		}
 
 		//! Write parts for specified request.
+		/*!
+		 * It's used for responses that are created on the connection's
+		 * own context (not by a request handler via write_response_parts()).
+		 */
 		void
 		write_response_parts_impl(
 			//! Request id.
@@ -988,8 +1367,35 @@ class connection_t final
 			response_output_flags_t response_output_flags,
 			//! Part of the response data.
 			write_group_t wg )
+		{
+			account_queued_output( wg );
+			append_response_parts(
+				request_id,
+				response_output_flags,
+				std::move( wg ) );
+		}
+
+		//! Append parts for specified request to the response queue.
+		/*!
+		 * @attention
+		 * Data in @a wg must be already accounted by
+		 * account_queued_output().
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		append_response_parts(
+			//! Request id.
+			request_id_t request_id,
+			//! Resp output flag.
+			response_output_flags_t response_output_flags,
+			//! Part of the response data.
+			write_group_t wg )
 		{
 			auto invoke_after_write_cb_with_error = [&]{
+				if( outgoing_data_limited() )
+					release_queued_output( output_size( wg ) );
+
 				try
 				{
 					wg.invoke_after_write_notificator_if_exists(
@@ -1112,15 +1518,6 @@ class connection_t final
 						next_write_group->first.items_count() );
 				} );
 
-				// Check if all response cells busy:
-				const bool response_coordinator_full_after =
-					m_response_coordinator.is_full();
-
-				// Whether we need to resume read after this group is written?
-				m_init_read_after_this_write =
-					response_coordinator_full_before &&
-					!response_coordinator_full_after;
-
 				if( 0 < next_write_group->first.status_line_size() )
 				{
 					// We need to extract status line out of the first buffer
@@ -1144,10 +1541,26 @@ class connection_t final
 					} );
 				}
 
+				if( outgoing_data_limited() )
+					m_bytes_in_current_write = output_size( next_write_group->first );
+
 				// Initialize write context with a new write group.
 				m_write_output_ctx.start_next_write_group(
 					std::move( next_write_group->first ) );
 
+				// Since v.0.7.10 ready responses for the next pipelined
+				// requests are written by the same gather write operation.
+				coalesce_ready_write_groups();
+
+				// Check if all response cells busy:
+				const bool response_coordinator_full_after =
+					m_response_coordinator.is_full();
+
+				// Whether we need to resume read after this group is written?
+				m_init_read_after_this_write =
+					response_coordinator_full_before &&
+					!response_coordinator_full_after;
+
 				// Start the loop of sending data from current write group.
 				handle_current_write_ctx();
 			}
@@ -1157,10 +1570,51 @@ class connection_t final
 			}
 		}
 
+		//! Add ready write groups to the current write operation.
+		/*!
+		 * Groups are taken from the response coordinator while they
+		 * consist of trivial buffers and fit into the limits of a single
+		 * gather write operation.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		coalesce_ready_write_groups()
+		{
+			for(;;)
+			{
+				const auto capacity = m_write_output_ctx.coalescing_capacity();
+				if( 0u == capacity.m_items )
+					break;
+
+				auto wg = m_response_coordinator.pop_ready_trivial_buffers(
+						capacity.m_items,
+						capacity.m_bytes );
+				if( !wg )
+					break;
+
+				m_logger.trace( [&]{
+					return fmt::format(
+						RESTINIO_FMT_FORMAT_STRING(
+							"[connection:{}] append write group for response (#{}), "
+							"size: {}" ),
+						this->connection_id(),
+						wg->second,
+						wg->first.items_count() );
+				} );
+
+				if( outgoing_data_limited() )
+					m_bytes_in_current_write += output_size( wg->first );
+
+				m_write_output_ctx.append_write_group( std::move( wg->first ) );
+			}
+		}
+
 		// Use aliases for shorter names.
 		using none_write_operation_t = write_group_output_ctx_t::none_write_operation_t;
 		using trivial_write_operation_t = write_group_output_ctx_t::trivial_write_operation_t;
 		using file_write_operation_t = write_group_output_ctx_t::file_write_operation_t;
+		using generator_write_operation_t = write_group_output_ctx_t::generator_write_operation_t;
 
 		//! Start/continue/continue handling output data of current write group.
 		/*!
@@ -1189,6 +1643,11 @@ class connection_t final
 				{
 					handle_file_write_operation( std::get< file_write_operation_t >( wo ) );
 				}
+				else if( std::holds_alternative< generator_write_operation_t >( wo ) )
+				{
+					handle_generator_write_operation(
+							std::get< generator_write_operation_t >( wo ) );
+				}
 				else
 				{
 					assert( std::holds_alternative< none_write_operation_t >( wo ) );
@@ -1207,9 +1666,84 @@ class connection_t final
 			}
 		}
 
+		//! Try to write trivial buffers synchronously.
+		/*!
+		 * @return true if all data was written. In that case the completion
+		 * of the write operation is posted to the connection's executor
+		 * (it isn't called directly because the write can be initiated
+		 * from the request handler invoked by the parser).
+		 *
+		 * If data is written partially then @a op is updated and
+		 * the rest of data has to be written asynchronously.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		try_write_trivial_bufs_first( trivial_write_operation_t & op )
+		{
+			if constexpr( std::is_base_of_v< asio_ns::socket_base, stream_socket_t > )
+			{
+				if( !m_settings->m_try_write_first )
+					return false;
+
+				asio_ns::error_code ec;
+				if( !m_socket.non_blocking() )
+				{
+					m_socket.non_blocking( true, ec );
+					if( ec )
+						return false;
+				}
+
+				const auto written = m_socket.write_some( op.get_trivial_bufs(), ec );
+				// NOTE: errors (including would_block) are handled
+				// by the async write operation.
+				if( ec )
+					return false;
+
+				m_logger.trace( [&]{
+					return fmt::format(
+							RESTINIO_FMT_FORMAT_STRING(
+								"[connection:{}] outgoing data was sent "
+								"synchronously: {} of {} bytes" ),
+							connection_id(),
+							written,
+							op.size() );
+				} );
+
+				if( written < op.size() )
+				{
+					op.consume( written );
+					return false;
+				}
+
+				asio_ns::post(
+					this->get_executor(),
+					[this, ctx = shared_from_this()]() noexcept {
+						RESTINIO_ENSURE_NOEXCEPT_CALL(
+								after_write( asio_ns::error_code{} ) );
+					} );
+				// The write operation is considered active until
+				// the posted completion is handled.
+				guard_write_operation();
+
+				return true;
+			}
+			else
+			{
+				(void)op;
+				return false;
+			}
+		}
+
 		//! Run trivial buffers write operation.
+		/*!
+		 * @note
+		 * Since v.0.7.10 @a op is a non-const reference because it can be
+		 * modified after a partial synchronous write.
+		 */
 		void
-		handle_trivial_write_operation( const trivial_write_operation_t & op )
+		handle_trivial_write_operation( trivial_write_operation_t & op )
 		{
 			// Asio buffers (param for async write):
 			auto & bufs = op.get_trivial_bufs();
@@ -1245,6 +1779,11 @@ class connection_t final
 						op.size() ); } );
 			}
 
+			// Since v.0.7.10 data can be written without waiting for
+			// the readiness of the socket.
+			if( try_write_trivial_bufs_first( op ) )
+				return;
+
 			// There is somethig to write.
 			asio_ns::async_write(
 				m_socket,
@@ -1360,6 +1899,76 @@ class connection_t final
 					} ) );
 		}
 
+		//! Run write operation for data of a body generator.
+		/*!
+		 * The next piece of data is pulled from the generator when
+		 * the previous one is written. When all data is generated
+		 * the handling of the current write group is continued.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		handle_generator_write_operation( generator_write_operation_t op )
+		{
+			if( m_response_coordinator.closed() &&
+				op.remaining() == op.size() )
+			{
+				// Reading new requests is useless.
+				asio_ns::error_code ignored_ec;
+				m_socket.cancel( ignored_ec );
+			}
+
+			const auto piece = op.next_piece();
+			if( 0u == piece.size() )
+			{
+				// All data of the generator is written.
+				handle_current_write_ctx();
+				return;
+			}
+
+			m_logger.trace( [&]{
+				return fmt::format(
+					RESTINIO_FMT_FORMAT_STRING(
+						"[connection:{}] sending generated resp data, "
+						"size: {}, remaining: {}" ),
+					connection_id(),
+					piece.size(),
+					op.remaining() );
+			} );
+
+			asio_ns::async_write(
+				m_socket,
+				piece,
+				asio_ns::bind_executor(
+					this->get_executor(),
+					[this, ctx = shared_from_this(), op]
+					( const asio_ns::error_code & ec, std::size_t ) noexcept
+					{
+						if( ec )
+						{
+							RESTINIO_ENSURE_NOEXCEPT_CALL( after_write( ec ) );
+							return;
+						}
+
+						try
+						{
+							handle_generator_write_operation( op );
+						}
+						catch( const std::exception & ex )
+						{
+							trigger_error_and_close( [&]{
+								return fmt::format(
+									RESTINIO_FMT_FORMAT_STRING(
+										"[connection:{}] body generator failed: {}" ),
+									connection_id(),
+									ex.what() );
+							} );
+						}
+					} ) );
+
+			guard_write_operation();
+		}
+
 		//! Do post write actions for current write group.
 		void
 		finish_handling_current_write_ctx()
@@ -1375,6 +1984,13 @@ class connection_t final
 			// Group notificators are called from here (if exist):
 			m_write_output_ctx.finish_write_group();
 
+			if( outgoing_data_limited() )
+			{
+				release_queued_output(
+						std::exchange( m_bytes_in_current_write, 0u ) );
+				notify_output_writable_waiters_if_necessary();
+			}
+
 			if( !m_response_coordinator.closed() )
 			{
 				m_logger.trace( [&]{
@@ -1561,6 +2177,12 @@ class connection_t final
 
 			RESTINIO_ENSURE_NOEXCEPT_CALL( m_response_coordinator.reset() );
 
+			// Producers waiting for the room in the output queue
+			// shouldn't wait anymore.
+			notify_output_writable_waiters(
+					make_asio_compaible_error(
+						asio_convertible_error_t::write_was_not_executed ) );
+
 			restinio::utils::log_trace_noexcept( m_logger,
 				[&]{
 					return fmt::format(
@@ -1598,6 +2220,170 @@ class connection_t final
 		}
 		//! \}
 
+		//! Is the amount of queued outgoing data limited?
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		outgoing_data_limited() const noexcept
+		{
+			return 0u != m_settings->m_outgoing_data_high_watermark;
+		}
+
+		//! Total size of data in a write group.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		static std::size_t
+		output_size( const write_group_t & wg ) noexcept
+		{
+			std::size_t result{ 0u };
+			for( const auto & item : wg.items() )
+				result += item.size();
+
+			return result;
+		}
+
+		//! Account data of a write group as queued.
+		/*!
+		 * Every write group has to be accounted before it's passed
+		 * to append_response_parts().
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		account_queued_output( const write_group_t & wg ) noexcept
+		{
+			if( outgoing_data_limited() )
+				m_queued_output_bytes.fetch_add(
+						output_size( wg ), std::memory_order_relaxed );
+		}
+
+		//! Account data that was written (or won't be written at all).
+		/*!
+		 * @since v.0.7.10
+		 */
+		void
+		release_queued_output( std::size_t bytes ) noexcept
+		{
+			m_queued_output_bytes.fetch_sub( bytes, std::memory_order_relaxed );
+		}
+
+		[[nodiscard]]
+		bool
+		output_is_writable() const noexcept override
+		{
+			return !outgoing_data_limited() ||
+				m_queued_output_bytes.load( std::memory_order_relaxed ) <
+					m_settings->m_outgoing_data_high_watermark;
+		}
+
+		void
+		when_output_writable( write_status_cb_t cb ) override
+		{
+			// The callback is never called directly to avoid a recursion
+			// in the producer's code.
+			asio_ns::post(
+				this->get_executor(),
+				[ this,
+					actual_cb = std::move( cb ),
+					ctx = shared_from_this() ]
+				() mutable noexcept
+				{
+					if( !m_socket.is_open() )
+						notify_output_writable_waiter(
+							actual_cb,
+							make_asio_compaible_error(
+								asio_convertible_error_t::write_was_not_executed ) );
+					else if( !outgoing_data_limited() ||
+							m_queued_output_bytes.load( std::memory_order_relaxed ) <=
+								m_settings->m_outgoing_data_low_watermark )
+						notify_output_writable_waiter(
+							actual_cb, asio_ns::error_code{} );
+					else
+						restinio::utils::suppress_exceptions(
+							m_logger,
+							"connection.when_output_writable",
+							[&] {
+								m_output_writable_waiters.push_back(
+										std::move( actual_cb ) );
+							} );
+				} );
+		}
+
+		//! Resume waiting producers if the low watermark is reached.
+		/*!
+		 * @since v.0.7.10
+		 */
+		void
+		notify_output_writable_waiters_if_necessary() noexcept
+		{
+			if( !m_output_writable_waiters.empty() &&
+					m_queued_output_bytes.load( std::memory_order_relaxed ) <=
+						m_settings->m_outgoing_data_low_watermark )
+			{
+				notify_output_writable_waiters( asio_ns::error_code{} );
+			}
+		}
+
+		//! Call all waiting producers.
+		/*!
+		 * @since v.0.7.10
+		 */
+		void
+		notify_output_writable_waiters( const asio_ns::error_code & ec ) noexcept
+		{
+			// Callbacks can add new waiters.
+			auto waiters = std::move( m_output_writable_waiters );
+			m_output_writable_waiters.clear();
+
+			for( auto & cb : waiters )
+				notify_output_writable_waiter( cb, ec );
+		}
+
+		void
+		notify_output_writable_waiter(
+			const write_status_cb_t & cb,
+			const asio_ns::error_code & ec ) noexcept
+		{
+			restinio::utils::suppress_exceptions(
+				m_logger,
+				"connection.output_writable_notificator",
+				[&] { cb( ec ); } );
+		}
+
+		//! Get a storage for input buffer from connection pool (if it's used).
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		static std::vector< char >
+		acquire_input_buffer_storage(
+			const connection_settings_t< Traits > & settings )
+		{
+			if( settings.m_connection_pool )
+				return settings.m_connection_pool->acquire_buffer();
+
+			return {};
+		}
+
+		//! Release the storage of input buffer.
+		/*!
+		 * The storage is returned to the connection pool (if it's used).
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		release_input_buffer_storage() noexcept
+		{
+			auto storage = m_input.m_buf.giveaway_storage();
+			if( m_settings->m_connection_pool )
+				m_settings->m_connection_pool->release_buffer(
+						std::move( storage ) );
+		}
+
 		//! Connection.
 		stream_socket_t m_socket;
 
@@ -1619,6 +2405,26 @@ class connection_t final
 		//! Response coordinator.
 		response_coordinator_t m_response_coordinator;
 
+		//! Amount of outgoing data that is queued but not written yet.
+		/*!
+		 * It's updated only if the high watermark is set.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::atomic< std::size_t > m_queued_output_bytes{ 0u };
+
+		//! Amount of data in the current write operation.
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_bytes_in_current_write{ 0u };
+
+		//! Producers that wait for the room in the output queue.
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::vector< write_status_cb_t > m_output_writable_waiters;
+
 		//! Timer to controll operations.
 		//! \{
 
@@ -1673,11 +2479,50 @@ class connection_t final
 		//! A prepared weak handle for passing it to timer guard.
 		tcp_connection_ctx_weak_handle_t m_prepared_weak_ctx;
 
+		/*!
+		 * @brief Are timeouts checked only at deadlines?
+		 *
+		 * If the timer guard supports scheduling at a time point then
+		 * the timer is armed only at the nearest deadline. A new deadline
+		 * that is not earlier than the armed one is just stored and
+		 * is checked when the timer fires.
+		 *
+		 * Otherwise timeouts are checked every check period.
+		 *
+		 * @since v.0.7.10
+		 */
+		static constexpr bool deadline_checking =
+				timer_guard_supports_deadlines_v< timer_guard_t >;
+
+		/*!
+		 * @brief The time point for which the timer is armed.
+		 *
+		 * It's time_point::max() if the timer isn't armed.
+		 *
+		 * @note
+		 * Is used only if deadline_checking is true.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::chrono::steady_clock::time_point m_armed_deadline{
+				std::chrono::steady_clock::time_point::max() };
+
 		//! Check timed out operation.
 		void
 		check_timeout_impl()
 		{
-			if( std::chrono::steady_clock::now() > m_current_timeout_after )
+			const auto now = std::chrono::steady_clock::now();
+
+			if constexpr( deadline_checking )
+			{
+				// The check can be initiated by a timer that was armed
+				// for an earlier deadline. So the timer is considered as
+				// disarmed only if its deadline is passed.
+				if( m_armed_deadline <= now )
+					m_armed_deadline = std::chrono::steady_clock::time_point::max();
+			}
+
+			if( now > m_current_timeout_after )
 			{
 				if( m_current_timeout_cb )
 					(this->*m_current_timeout_cb)();
@@ -1692,7 +2537,21 @@ class connection_t final
 		void
 		init_next_timeout_checking()
 		{
-			m_timer_guard.schedule( m_prepared_weak_ctx );
+			if constexpr( deadline_checking )
+			{
+				// Nothing to do if there is no guarded operation or
+				// the timer is already armed for an earlier time point.
+				if( m_current_timeout_cb &&
+						m_current_timeout_after < m_armed_deadline )
+				{
+					m_timer_guard.schedule_at(
+							m_prepared_weak_ctx,
+							m_current_timeout_after );
+					m_armed_deadline = m_current_timeout_after;
+				}
+			}
+			else
+				m_timer_guard.schedule( m_prepared_weak_ctx );
 		}
 
 		//! Stop timout guarding.
@@ -1701,6 +2560,9 @@ class connection_t final
 		{
 			m_current_timeout_cb = nullptr;
 			RESTINIO_ENSURE_NOEXCEPT_CALL( m_timer_guard.cancel() );
+
+			if constexpr( deadline_checking )
+				m_armed_deadline = std::chrono::steady_clock::time_point::max();
 		}
 
 		//! Helper function to work with timer guard.
@@ -1711,6 +2573,11 @@ class connection_t final
 		{
 			m_current_timeout_after = timeout_after;
 			m_current_timeout_cb = timout_cb;
+
+			// NOTE: the timer is rearmed only if the new deadline
+			// is earlier than the armed one (or the timer isn't armed).
+			if constexpr( deadline_checking )
+				init_next_timeout_checking();
 		}
 
 		void
@@ -1808,6 +2675,13 @@ class connection_t final
 		//! Request handler.
 		request_handler_t & m_request_handler;
 
+		/*!
+		 * @brief Allocator for request objects.
+		 *
+		 * @since v.0.7.10
+		 */
+		request_allocator_type_from_traits_t< Traits > m_request_allocator;
+
 		//! Logger for operation
 		logger_t & m_logger;
 
@@ -1861,6 +2735,19 @@ class connection_factory_t
 				(*m_socket_options_setter)( options );
 			}
 
+			if( m_connection_settings->m_connection_pool )
+			{
+				// Connection object is created in a memory block from the pool.
+				return std::allocate_shared< connection_type_t >(
+					connection_pool_allocator_t< connection_type_t >{
+						m_connection_settings->m_connection_pool },
+					m_connection_id_counter++,
+					std::move( socket ),
+					m_connection_settings,
+					std::move( remote_endpoint ),
+					std::move( lifetime_monitor ) );
+			}
+
 			return std::make_shared< connection_type_t >(
 				m_connection_id_counter++,
 				std::move( socket ),
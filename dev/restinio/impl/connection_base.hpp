@@ -32,6 +32,22 @@ class connection_base_t
 			:	tcp_connection_ctx_base_t{ id }
 		{}
 
+		/*!
+		 * @since v.0.7.10
+		 */
+		connection_base_t(connection_id_t id, bool auto_date_field )
+			:	tcp_connection_ctx_base_t{ id }
+			,	m_auto_date_field{ auto_date_field }
+		{}
+
+		//! Should `Date` field be added to every response?
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		auto_date_field() const noexcept { return m_auto_date_field; }
+
 		//! Write parts for specified request.
 		virtual void
 		write_response_parts(
@@ -41,6 +57,50 @@ class connection_base_t
 			response_output_flags_t response_output_flags,
 			//! Part of the response data.
 			write_group_t wg ) = 0;
+
+		//! Is there room for more outgoing data?
+		/*!
+		 * Returns false if the amount of outgoing data queued by
+		 * the connection reached the high watermark.
+		 *
+		 * @note
+		 * Can be called from any thread.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		virtual bool
+		output_is_writable() const noexcept { return true; }
+
+		//! Call @a cb when the producer of outgoing data may continue.
+		/*!
+		 * The callback is called with an empty error code when the amount
+		 * of queued outgoing data falls to the low watermark. If
+		 * the connection is closed before that the callback is called
+		 * with an error.
+		 *
+		 * An implementation should call @a cb on the connection's
+		 * executor, not from this method, because the callback can
+		 * acquire locks that are held by the caller.
+		 *
+		 * @note
+		 * This default implementation is for connections that don't
+		 * limit outgoing data (like stubs in tests). There is no executor
+		 * here, so @a cb is called right from this method.
+		 *
+		 * @since v.0.7.10
+		 */
+		virtual void
+		when_output_writable( write_status_cb_t cb )
+		{
+			cb( asio_ns::error_code{} );
+		}
+
+	private:
+		/*!
+		 * @since v.0.7.10
+		 */
+		const bool m_auto_date_field{ false };
 };
 
 //! Alias for http connection handle.
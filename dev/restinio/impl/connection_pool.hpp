@@ -0,0 +1,348 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief A pool for memory blocks and input buffers of connections.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/exception.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace restinio
+{
+
+//
+// connection_pool_stats_t
+//
+/*!
+ * @brief Statistics of the pool of connection objects.
+ *
+ * Hit means that a memory block for a new connection was taken from
+ * the pool. Miss means that a memory block was allocated via
+ * the ordinary `operator new`.
+ *
+ * @since v.0.7.10
+ */
+class connection_pool_stats_t
+{
+		std::uint64_t m_hits{ 0u };
+		std::uint64_t m_misses{ 0u };
+		std::size_t m_free_blocks{ 0u };
+		std::size_t m_free_buffers{ 0u };
+
+	public:
+		connection_pool_stats_t() noexcept = default;
+
+		connection_pool_stats_t(
+			std::uint64_t hits,
+			std::uint64_t misses,
+			std::size_t free_blocks,
+			std::size_t free_buffers ) noexcept
+			:	m_hits{ hits }
+			,	m_misses{ misses }
+			,	m_free_blocks{ free_blocks }
+			,	m_free_buffers{ free_buffers }
+		{}
+
+		//! How many times a connection object was created in pooled memory.
+		[[nodiscard]]
+		std::uint64_t
+		hits() const noexcept { return m_hits; }
+
+		//! How many times a memory for connection object was allocated.
+		[[nodiscard]]
+		std::uint64_t
+		misses() const noexcept { return m_misses; }
+
+		//! How many memory blocks are kept in the pool now.
+		[[nodiscard]]
+		std::size_t
+		free_blocks() const noexcept { return m_free_blocks; }
+
+		//! How many input buffers are kept in the pool now.
+		[[nodiscard]]
+		std::size_t
+		free_buffers() const noexcept { return m_free_buffers; }
+};
+
+namespace impl
+{
+
+//
+// connection_pool_t
+//
+/*!
+ * @brief A pool for memory blocks and input buffers of connections.
+ *
+ * Connection objects are created by std::allocate_shared with
+ * connection_pool_allocator_t, so the connection object and its
+ * shared_ptr's control block occupy one memory block. When such block
+ * is released it is returned to the pool (if the pool is not full)
+ * and is reused for the next connection.
+ *
+ * Input buffers of connections are also returned to the pool and
+ * reused by new connections.
+ *
+ * @note
+ * The pool is thread safe because the last reference to a connection
+ * can be released on any thread (e.g. on a thread where a request was
+ * handled). The pool belongs to an instance of http_server_t, so there
+ * is one pool per shard in shard-per-thread mode.
+ *
+ * @since v.0.7.10
+ */
+class connection_pool_t
+{
+	public:
+		connection_pool_t( const connection_pool_t & ) = delete;
+		connection_pool_t & operator=( const connection_pool_t & ) = delete;
+
+		explicit connection_pool_t( std::size_t capacity )
+			:	m_capacity{ capacity }
+		{
+			if( !m_capacity )
+				throw exception_t{ "connection pool capacity can't be 0" };
+		}
+
+		~connection_pool_t()
+		{
+			for( void * block : m_free_blocks )
+				::operator delete( block );
+		}
+
+		//! Get a memory block for connection object.
+		[[nodiscard]]
+		void *
+		allocate_block( std::size_t size )
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+
+				if( !m_block_size )
+					m_block_size = size;
+
+				if( size == m_block_size && !m_free_blocks.empty() )
+				{
+					void * block = m_free_blocks.back();
+					m_free_blocks.pop_back();
+					++m_hits;
+					return block;
+				}
+
+				++m_misses;
+			}
+
+			return ::operator new( size );
+		}
+
+		//! Return a memory block of connection object.
+		void
+		deallocate_block( void * block, std::size_t size ) noexcept
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+
+				if( size == m_block_size && m_free_blocks.size() < m_capacity )
+				{
+					// Can't throw because the necessary capacity is
+					// reserved in advance.
+					m_free_blocks.push_back( block );
+					return;
+				}
+			}
+
+			::operator delete( block );
+		}
+
+		//! Get storage for an input buffer.
+		/*!
+		 * Returns an empty vector if there is no buffer in the pool.
+		 */
+		[[nodiscard]]
+		std::vector< char >
+		acquire_buffer()
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			std::vector< char > result;
+			if( !m_free_buffers.empty() )
+			{
+				result = std::move( m_free_buffers.back() );
+				m_free_buffers.pop_back();
+			}
+
+			return result;
+		}
+
+		//! Return storage of an input buffer to the pool.
+		void
+		release_buffer( std::vector< char > buffer ) noexcept
+		{
+			if( buffer.capacity() )
+			{
+				std::lock_guard< std::mutex > lock{ m_lock };
+
+				if( m_free_buffers.size() < m_capacity )
+					// Can't throw because the necessary capacity is
+					// reserved in advance.
+					m_free_buffers.push_back( std::move( buffer ) );
+			}
+		}
+
+		//! Get the current statistics.
+		[[nodiscard]]
+		connection_pool_stats_t
+		stats() const
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			return {
+					m_hits,
+					m_misses,
+					m_free_blocks.size(),
+					m_free_buffers.size()
+				};
+		}
+
+		//! Reserve space for pool's containers.
+		/*!
+		 * @note
+		 * It's a separate method because the constructor is used only
+		 * for the checking of capacity value and the reservation can
+		 * be postponed until the first connection is created.
+		 */
+		void
+		reserve()
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			m_free_blocks.reserve( m_capacity );
+			m_free_buffers.reserve( m_capacity );
+		}
+
+	private:
+		//! Max count of kept blocks (and buffers).
+		const std::size_t m_capacity;
+
+		mutable std::mutex m_lock;
+
+		//! Size of a block for connection object.
+		/*!
+		 * Is detected at the first allocation. Blocks of other size are
+		 * not kept in the pool.
+		 */
+		std::size_t m_block_size{ 0u };
+
+		std::vector< void * > m_free_blocks;
+		std::vector< std::vector< char > > m_free_buffers;
+
+		std::uint64_t m_hits{ 0u };
+		std::uint64_t m_misses{ 0u };
+};
+
+//! Alias for shared pointer to connection pool.
+using connection_pool_handle_t = std::shared_ptr< connection_pool_t >;
+
+//
+// make_connection_pool
+//
+/*!
+ * @brief Create connection pool if it is enabled by settings.
+ *
+ * @return nullptr if @a capacity is zero.
+ *
+ * @since v.0.7.10
+ */
+[[nodiscard]]
+inline connection_pool_handle_t
+make_connection_pool( std::size_t capacity )
+{
+	connection_pool_handle_t result;
+	if( capacity )
+	{
+		result = std::make_shared< connection_pool_t >( capacity );
+		result->reserve();
+	}
+
+	return result;
+}
+
+//
+// connection_pool_allocator_t
+//
+/*!
+ * @brief Allocator to be used with std::allocate_shared for creation
+ * of connection objects in pooled memory.
+ *
+ * Holds a shared pointer to the pool, so the pool lives while there is
+ * at least one connection object created by that allocator.
+ *
+ * @since v.0.7.10
+ */
+template< typename T >
+class connection_pool_allocator_t
+{
+	template< typename U >
+	friend class connection_pool_allocator_t;
+
+	connection_pool_handle_t m_pool;
+
+	public:
+		using value_type = T;
+
+		explicit connection_pool_allocator_t(
+			connection_pool_handle_t pool ) noexcept
+			:	m_pool{ std::move( pool ) }
+		{}
+
+		template< typename U >
+		connection_pool_allocator_t(
+			const connection_pool_allocator_t< U > & other ) noexcept
+			:	m_pool{ other.m_pool }
+		{}
+
+		[[nodiscard]]
+		T *
+		allocate( std::size_t n )
+		{
+			static_assert( alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+					"over-aligned types are not supported" );
+
+			return static_cast< T * >( m_pool->allocate_block( n * sizeof(T) ) );
+		}
+
+		void
+		deallocate( T * p, std::size_t n ) noexcept
+		{
+			m_pool->deallocate_block( p, n * sizeof(T) );
+		}
+
+		template< typename U >
+		bool
+		operator==( const connection_pool_allocator_t< U > & o ) const noexcept
+		{
+			return m_pool == o.m_pool;
+		}
+
+		template< typename U >
+		bool
+		operator!=( const connection_pool_allocator_t< U > & o ) const noexcept
+		{
+			return m_pool != o.m_pool;
+		}
+};
+
+} /* namespace impl */
+
+} /* namespace restinio */
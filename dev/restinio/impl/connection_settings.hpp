@@ -11,7 +11,9 @@
 #include <llhttp.h>
 
 #include <restinio/connection_state_listener.hpp>
+#include <restinio/impl/connection_pool.hpp>
 #include <restinio/incoming_http_msg_limits.hpp>
+#include <restinio/response_cache.hpp>
 
 #include <restinio/utils/suppress_exceptions.hpp>
 
@@ -140,11 +142,29 @@ struct connection_settings_t final
 	connection_settings_t(
 		Settings && settings,
 		llhttp_settings_t parser_settings,
-		timer_manager_handle_t timer_manager )
+		timer_manager_handle_t timer_manager,
+		//! Pool for connection objects (can be nullptr).
+		//! Since v.0.7.10.
+		connection_pool_handle_t connection_pool )
 		:	connection_state_listener_holder_t{ settings }
 		,	m_request_handler{ settings.request_handler() }
 		,	m_parser_settings{ parser_settings }
 		,	m_buffer_size{ settings.buffer_size() }
+		,	m_initial_buffer_size{
+				0u != settings.initial_buffer_size()
+					? settings.initial_buffer_size()
+					: settings.buffer_size() }
+		,	m_release_idle_input_buffer{ settings.release_idle_input_buffer() }
+		,	m_try_write_first{ settings.try_write_first() }
+		,	m_auto_date_field{ settings.auto_date_field() }
+		,	m_outgoing_data_high_watermark{
+				settings.outgoing_data_high_watermark() }
+		,	m_outgoing_data_low_watermark{
+				settings.outgoing_data_low_watermark() }
+		,	m_response_cache{ settings.response_cache() }
+		,	m_request_body_as_rope{ settings.request_body_as_rope() }
+		,	m_request_body_rope_segment_capacity{
+				settings.request_body_rope_segment_capacity() }
 		,	m_incoming_http_msg_limits{ settings.incoming_http_msg_limits() }
 		,	m_read_next_http_message_timelimit{
 				settings.read_next_http_message_timelimit() }
@@ -154,6 +174,7 @@ struct connection_settings_t final
 				settings.handle_request_timeout() }
 		,	m_max_pipelined_requests{ settings.max_pipelined_requests() }
 		,	m_logger{ settings.logger() }
+		,	m_connection_pool{ std::move( connection_pool ) }
 		,	m_timer_manager{ std::move( timer_manager ) }
 		,	m_extra_data_factory{ settings.giveaway_extra_data_factory() }
 	{
@@ -162,6 +183,11 @@ struct connection_settings_t final
 
 		if( !m_extra_data_factory )
 			throw exception_t{ "extra_data_factory is nullptr" };
+
+		if( 0u != m_outgoing_data_high_watermark &&
+				m_outgoing_data_low_watermark >= m_outgoing_data_high_watermark )
+			throw exception_t{
+				"outgoing data low watermark must be less than high watermark" };
 	}
 
 	//! Request handler factory.
@@ -177,6 +203,69 @@ struct connection_settings_t final
 	//! \{
 	std::size_t m_buffer_size;
 
+	/*!
+	 * @brief Initial size of the input buffer.
+	 *
+	 * It's equal to m_buffer_size if the input buffer has fixed size.
+	 *
+	 * @since v.0.7.10
+	 */
+	std::size_t m_initial_buffer_size;
+
+	/*!
+	 * @brief Should the input buffer be released while connection is idle?
+	 *
+	 * @since v.0.7.10
+	 */
+	bool m_release_idle_input_buffer;
+
+	/*!
+	 * @brief Should data be written synchronously before async write?
+	 *
+	 * @since v.0.7.10
+	 */
+	bool m_try_write_first;
+
+	/*!
+	 * @brief Should `Date` field be added to every response?
+	 *
+	 * @since v.0.7.10
+	 */
+	bool m_auto_date_field;
+
+	/*!
+	 * @brief Watermarks for the amount of queued outgoing data.
+	 *
+	 * Zero value of the high watermark means no limits.
+	 *
+	 * @since v.0.7.10
+	 */
+	//! @{
+	std::size_t m_outgoing_data_high_watermark;
+	std::size_t m_outgoing_data_low_watermark;
+	//! @}
+
+	/*!
+	 * @brief Cache of responses (can be nullptr).
+	 *
+	 * @since v.0.7.10
+	 */
+	const std::shared_ptr< response_cache_t > m_response_cache;
+
+	/*!
+	 * @brief Should bodies of incoming requests be stored as ropes?
+	 *
+	 * @since v.0.7.10
+	 */
+	bool m_request_body_as_rope;
+
+	/*!
+	 * @brief Capacity of a segment of a body stored as a rope.
+	 *
+	 * @since v.0.7.10
+	 */
+	std::size_t m_request_body_rope_segment_capacity;
+
 	/*!
 	 * @since v.0.6.12
 	 */
@@ -196,6 +285,15 @@ struct connection_settings_t final
 	const std::unique_ptr< logger_t > m_logger;
 	//! \}
 
+	/*!
+	 * @brief Pool for connection objects.
+	 *
+	 * It's nullptr if the pool isn't used.
+	 *
+	 * @since v.0.7.10
+	 */
+	const connection_pool_handle_t m_connection_pool;
+
 	//! Create new timer guard.
 	auto
 	create_timer_guard()
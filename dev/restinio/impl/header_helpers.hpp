@@ -8,10 +8,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <charconv>
 #include <numeric>
 
 #include <restinio/buffers.hpp>
+#include <restinio/string_view.hpp>
 
 namespace restinio
 {
@@ -36,6 +39,150 @@ enum class content_length_field_presence_t : std::uint8_t
 	skip_content_length
 };
 
+enum class final_crlf_presence_t : std::uint8_t
+{
+	add_final_crlf,
+	skip_final_crlf
+};
+
+//
+// prebuilt_status_line_t
+//
+/*!
+ * @brief A pre-serialized status line for a standard status code.
+ *
+ * @since v.0.7.10
+ */
+struct prebuilt_status_line_t
+{
+	std::uint16_t m_code;
+	//! The whole line including the trailing "\r\n".
+	string_view_t m_line;
+};
+
+//! Pre-serialized HTTP/1.1 status lines for all http_status_code_t constants.
+/*!
+ * Items are sorted by status code.
+ *
+ * @since v.0.7.10
+ */
+inline constexpr std::array< prebuilt_status_line_t, 51 >
+	prebuilt_status_lines{
+		{
+			{ 100, "HTTP/1.1 100 Continue\r\n" },
+			{ 101, "HTTP/1.1 101 Switching Protocols\r\n" },
+			{ 102, "HTTP/1.1 102 Processing\r\n" },
+			{ 200, "HTTP/1.1 200 OK\r\n" },
+			{ 201, "HTTP/1.1 201 Created\r\n" },
+			{ 202, "HTTP/1.1 202 Accepted\r\n" },
+			{ 203, "HTTP/1.1 203 Non-Authoritative Information\r\n" },
+			{ 204, "HTTP/1.1 204 No Content\r\n" },
+			{ 205, "HTTP/1.1 205 Reset Content\r\n" },
+			{ 206, "HTTP/1.1 206 Partial Content\r\n" },
+			{ 207, "HTTP/1.1 207 Multi-Status\r\n" },
+			{ 300, "HTTP/1.1 300 Multiple Choices\r\n" },
+			{ 301, "HTTP/1.1 301 Moved Permanently\r\n" },
+			{ 302, "HTTP/1.1 302 Found\r\n" },
+			{ 303, "HTTP/1.1 303 See Other\r\n" },
+			{ 304, "HTTP/1.1 304 Not Modified\r\n" },
+			{ 305, "HTTP/1.1 305 Use Proxy\r\n" },
+			{ 307, "HTTP/1.1 307 Temporary Redirect\r\n" },
+			{ 308, "HTTP/1.1 308 Permanent Redirect\r\n" },
+			{ 400, "HTTP/1.1 400 Bad Request\r\n" },
+			{ 401, "HTTP/1.1 401 Unauthorized\r\n" },
+			{ 402, "HTTP/1.1 402 Payment Required\r\n" },
+			{ 403, "HTTP/1.1 403 Forbidden\r\n" },
+			{ 404, "HTTP/1.1 404 Not Found\r\n" },
+			{ 405, "HTTP/1.1 405 Method Not Allowed\r\n" },
+			{ 406, "HTTP/1.1 406 Not Acceptable\r\n" },
+			{ 407, "HTTP/1.1 407 Proxy Authentication Required\r\n" },
+			{ 408, "HTTP/1.1 408 Request Timeout\r\n" },
+			{ 409, "HTTP/1.1 409 Conflict\r\n" },
+			{ 410, "HTTP/1.1 410 Gone\r\n" },
+			{ 411, "HTTP/1.1 411 Length Required\r\n" },
+			{ 412, "HTTP/1.1 412 Precondition Failed\r\n" },
+			{ 413, "HTTP/1.1 413 Payload Too Large\r\n" },
+			{ 414, "HTTP/1.1 414 URI Too Long\r\n" },
+			{ 415, "HTTP/1.1 415 Unsupported Media Type\r\n" },
+			{ 416, "HTTP/1.1 416 Requested Range Not Satisfiable\r\n" },
+			{ 417, "HTTP/1.1 417 Expectation Failed\r\n" },
+			{ 422, "HTTP/1.1 422 Unprocessable Entity\r\n" },
+			{ 423, "HTTP/1.1 423 Locked\r\n" },
+			{ 424, "HTTP/1.1 424 Failed Dependency\r\n" },
+			{ 428, "HTTP/1.1 428 Precondition Required\r\n" },
+			{ 429, "HTTP/1.1 429 Too Many Requests\r\n" },
+			{ 431, "HTTP/1.1 431 Request Header Fields Too Large\r\n" },
+			{ 500, "HTTP/1.1 500 Internal Server Error\r\n" },
+			{ 501, "HTTP/1.1 501 Not Implemented\r\n" },
+			{ 502, "HTTP/1.1 502 Bad Gateway\r\n" },
+			{ 503, "HTTP/1.1 503 Service Unavailable\r\n" },
+			{ 504, "HTTP/1.1 504 Gateway Timeout\r\n" },
+			{ 505, "HTTP/1.1 505 HTTP Version not supported\r\n" },
+			{ 507, "HTTP/1.1 507 Insufficient Storage\r\n" },
+			{ 511, "HTTP/1.1 511 Network Authentication Required\r\n" },
+		}
+	};
+
+//
+// find_prebuilt_status_line()
+//
+/*!
+ * @brief Find a pre-serialized HTTP/1.1 status line.
+ *
+ * A pre-serialized line is used only for a standard status code with
+ * the standard reason phrase.
+ *
+ * @return empty string_view if there is no appropriate line.
+ *
+ * @since v.0.7.10
+ */
+[[nodiscard]]
+inline string_view_t
+find_prebuilt_status_line(
+	http_status_code_t status_code,
+	string_view_t reason_phrase ) noexcept
+{
+	const auto sc = status_code.raw_code();
+	const auto it = std::lower_bound(
+			prebuilt_status_lines.begin(),
+			prebuilt_status_lines.end(),
+			sc,
+			[]( const prebuilt_status_line_t & item, std::uint16_t code ) {
+				return item.m_code < code;
+			} );
+
+	if( it == prebuilt_status_lines.end() || it->m_code != sc )
+		return {};
+
+	// "HTTP/1.1 xxx " prefix and "\r\n" suffix are skipped.
+	constexpr std::size_t prefix_size = 13u;
+	if( it->m_line.substr( prefix_size, it->m_line.size() - prefix_size - 2u )
+			!= reason_phrase )
+		return {};
+
+	return it->m_line;
+}
+
+/*!
+ * @brief Find a pre-serialized status line for a response header.
+ *
+ * A pre-serialized line is used only for HTTP/1.1 responses with
+ * a standard status code and the standard reason phrase.
+ *
+ * @return empty string_view if there is no appropriate line.
+ *
+ * @since v.0.7.10
+ */
+[[nodiscard]]
+inline string_view_t
+find_prebuilt_status_line( const http_response_header_t & h ) noexcept
+{
+	if( 1 != h.http_major() || 1 != h.http_minor() )
+		return {};
+
+	return find_prebuilt_status_line( h.status_code(), h.reason_phrase() );
+}
+
 //
 // calculate_approx_buffer_size_for_header()
 //
@@ -60,33 +207,30 @@ calculate_approx_buffer_size_for_header(
 }
 
 //
-// create_header_string()
+// append_status_line()
 //
 
-//! Creates a string for http response header.
-inline std::string
-create_header_string(
-	const http_response_header_t & h,
-	content_length_field_presence_t content_length_field_presence =
-		content_length_field_presence_t::add_content_length,
-	std::size_t buffer_size = 0 )
+//! Serializes a status line.
+/*!
+ * @since v.0.7.10
+ */
+inline void
+append_status_line(
+	std::string & result,
+	std::uint16_t http_major,
+	std::uint16_t http_minor,
+	http_status_code_t status_code,
+	string_view_t reason_phrase )
 {
-	std::string result;
-
-	if( 0 != buffer_size )
-		result.reserve( buffer_size );
-	else
-		result.reserve( calculate_approx_buffer_size_for_header( h ) );
-
 	constexpr const char header_part1[] = "HTTP/";
 	result.append( header_part1, ct_string_len( header_part1 ) );
 
-	result += static_cast<char>( '0' + h.http_major() );
+	result += static_cast<char>( '0' + http_major );
 	result += '.';
-	result += static_cast<char>( '0' + h.http_minor() );
+	result += static_cast<char>( '0' + http_minor );
 	result += ' ';
 
-	const auto sc = h.status_code().raw_code();
+	const auto sc = status_code.raw_code();
 
 //FIXME: there should be a check for status_code in range 100..999.
 //May be a special type like bounded_value_t<100,999> must be used in
@@ -96,12 +240,41 @@ create_header_string(
 	result += '0' + ( sc ) % 10;
 
 	result += ' ';
-	result += h.reason_phrase();
+	result.append( reason_phrase.data(), reason_phrase.size() );
 
 	constexpr const char header_rn[] = "\r\n";
 	result.append( header_rn, ct_string_len( header_rn ) );
+}
 
-	switch( h.connection() )
+//! Serializes the status line of a response header.
+/*!
+ * @since v.0.7.10
+ */
+inline void
+append_status_line( std::string & result, const http_response_header_t & h )
+{
+	append_status_line(
+			result,
+			h.http_major(),
+			h.http_minor(),
+			h.status_code(),
+			h.reason_phrase() );
+}
+
+//
+// append_connection_field()
+//
+
+//! Serializes `Connection` field.
+/*!
+ * @since v.0.7.10
+ */
+inline void
+append_connection_field(
+	std::string & result,
+	http_connection_header_t connection )
+{
+	switch( connection )
 	{
 		case http_connection_header_t::keep_alive:
 		{
@@ -124,19 +297,82 @@ create_header_string(
 			break;
 		}
 	}
+}
+
+//
+// append_content_length_field()
+//
+
+//! Serializes `Content-Length` field.
+/*!
+ * @since v.0.7.10
+ */
+inline void
+append_content_length_field(
+	std::string & result,
+	std::uint64_t content_length )
+{
+	constexpr const char header_content_length[] = "Content-Length: ";
+	result.append(
+			header_content_length, ct_string_len( header_content_length ) );
+
+	std::array< char, 24 > buf;
+	const auto r = std::to_chars(
+			buf.data(), buf.data() + buf.size(), content_length );
+	result.append( buf.data(), r.ptr );
+
+	constexpr const char header_rn[] = "\r\n";
+	result.append( header_rn, ct_string_len( header_rn ) );
+}
+
+//
+// create_header_string()
+//
+
+//! Creates a string for http response header.
+/*!
+ * @note
+ * Since v.0.7.10 a pre-serialized status line is used for standard
+ * status codes.
+ *
+ * Since v.0.7.10 the final "\r\n" can be omitted. It's necessary if
+ * the header is continued by pre-serialized fields
+ * (see header_template_t).
+ */
+inline std::string
+create_header_string(
+	const http_response_header_t & h,
+	content_length_field_presence_t content_length_field_presence =
+		content_length_field_presence_t::add_content_length,
+	std::size_t buffer_size = 0,
+	final_crlf_presence_t final_crlf_presence =
+		final_crlf_presence_t::add_final_crlf )
+{
+	std::string result;
+
+	if( 0 != buffer_size )
+		result.reserve( buffer_size );
+	else
+		result.reserve( calculate_approx_buffer_size_for_header( h ) );
+
+	constexpr const char header_rn[] = "\r\n";
+
+	if( const auto prebuilt = find_prebuilt_status_line( h );
+			!prebuilt.empty() )
+	{
+		result.append( prebuilt.data(), prebuilt.size() );
+	}
+	else
+	{
+		append_status_line( result, h );
+	}
+
+	append_connection_field( result, h.connection() );
 
 	if( content_length_field_presence_t::add_content_length ==
 		content_length_field_presence )
 	{
-		std::array< char, 64 > buf;
-		const auto n =
-			std::snprintf(
-				buf.data(),
-				buf.size(),
-				"Content-Length: %llu\r\n",
-				static_cast< unsigned long long >( h.content_length() ) );
-
-		result.append( buf.data(), static_cast<std::string::size_type>(n) );
+		append_content_length_field( result, h.content_length() );
 	}
 
 	constexpr const char header_field_sep[] = ": ";
@@ -147,7 +383,8 @@ create_header_string(
 		result.append( header_rn, ct_string_len( header_rn ) );
 	} );
 
-	result.append( header_rn, ct_string_len( header_rn ) );
+	if( final_crlf_presence_t::add_final_crlf == final_crlf_presence )
+		result.append( header_rn, ct_string_len( header_rn ) );
 
 	return result;
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include <restinio/asio_include.hpp>
 
@@ -198,6 +200,134 @@ class ioctx_on_thread_pool_t
 		status_t m_status;
 };
 
+/*!
+ * @brief Helper class for running a separate io_context on every
+ * thread of a thread pool.
+ *
+ * Unlike ioctx_on_thread_pool_t there is no shared io_context: every
+ * worker thread owns its own io_context instance (a shard) and runs it
+ * via `io_context::run()`. Handlers posted to a shard are always
+ * executed on the same thread, so objects bound to a shard don't need
+ * any synchronization.
+ *
+ * \note class is not thread-safe (except `io_context()` and `size()`
+ * methods). Expected usage scenario is to start and stop it on the same
+ * thread.
+ *
+ * @since v.0.7.10
+ */
+class ioctx_per_thread_pool_t
+{
+	public:
+		ioctx_per_thread_pool_t( const ioctx_per_thread_pool_t & ) = delete;
+		ioctx_per_thread_pool_t( ioctx_per_thread_pool_t && ) = delete;
+
+		ioctx_per_thread_pool_t(
+			// Pool size (it's also the number of io_contexts).
+			std::size_t pool_size )
+			:	m_pool( pool_size_checking::ensure_pool_size_non_zero( pool_size ) )
+			,	m_status( status_t::stopped )
+		{
+			m_shards.reserve( pool_size );
+			for( std::size_t i = 0u; i != pool_size; ++i )
+				m_shards.emplace_back( std::make_unique< asio_ns::io_context >( 1 ) );
+		}
+
+		// Makes sure the pool is stopped.
+		~ioctx_per_thread_pool_t()
+		{
+			if( started() )
+			{
+				stop();
+				wait();
+			}
+		}
+
+		void
+		start()
+		{
+			if( started() )
+			{
+				throw exception_t{
+					"io_context_per_thread_pool is already started" };
+			}
+
+			try
+			{
+				for( std::size_t i = 0u; i != m_pool.size(); ++i )
+				{
+					m_pool[ i ] = std::thread{ [ioctx = m_shards[ i ].get()] {
+							auto work{ asio_ns::make_work_guard( *ioctx ) };
+
+							ioctx->run();
+						} };
+				}
+
+				// When all thread started successfully
+				// status can be changed.
+				m_status = status_t::started;
+			}
+			catch( const std::exception & )
+			{
+				for( auto & ioctx : m_shards )
+					ioctx->stop();
+				for( auto & t : m_pool )
+					if( t.joinable() )
+						t.join();
+
+				throw;
+			}
+		}
+
+		//! Stop all shards.
+		void
+		stop() noexcept
+		{
+			if( started() )
+			{
+				for( auto & ioctx : m_shards )
+					ioctx->stop();
+			}
+		}
+
+		void
+		wait() noexcept
+		{
+			if( started() )
+			{
+				for( auto & t : m_pool )
+					t.join();
+
+				// When all threads are stopped status can be changed.
+				m_status = status_t::stopped;
+			}
+		}
+
+		bool started() const noexcept { return status_t::started == m_status; }
+
+		//! Get the number of shards.
+		std::size_t size() const noexcept { return m_shards.size(); }
+
+		//! Get io_context of the specified shard.
+		asio_ns::io_context &
+		io_context( std::size_t shard_index ) noexcept
+		{
+			return *(m_shards[ shard_index ]);
+		}
+
+	private:
+		enum class status_t : std::uint8_t { stopped, started };
+
+		//! io_context for every thread.
+		/*!
+		 * @note
+		 * io_context is not Moveable, so it's stored by unique_ptr.
+		 */
+		std::vector< std::unique_ptr< asio_ns::io_context > > m_shards;
+		std::vector< std::thread > m_pool;
+		status_t m_status;
+};
+
 } /* namespace impl */
 
 } /* namespace restinio */
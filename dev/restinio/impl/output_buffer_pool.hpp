@@ -0,0 +1,194 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Per-thread pool of buffers for serialized output data.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/utils/suppress_exceptions.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace restinio
+{
+
+namespace impl
+{
+
+//
+// output_buffer_pool_t
+//
+/*!
+ * @brief A pool of string buffers for serialized output data.
+ *
+ * Buffers are returned to the pool after the data is written, so the
+ * memory is reused for the next responses.
+ *
+ * @note
+ * This class isn't thread safe. There is an instance for every thread
+ * (see thread_local_output_buffer_pool()).
+ *
+ * @since v.0.7.10
+ */
+class output_buffer_pool_t
+{
+	public:
+		//! Max count of kept buffers.
+		static constexpr std::size_t max_buffers = 64u;
+
+		//! Max capacity of a buffer to be kept in the pool.
+		static constexpr std::size_t max_buffer_capacity = 16u * 1024u;
+
+		output_buffer_pool_t()
+		{
+			m_buffers.reserve( max_buffers );
+		}
+
+		//! Get a buffer (it can be a new empty string).
+		[[nodiscard]]
+		std::string
+		acquire() noexcept
+		{
+			std::string result;
+			if( !m_buffers.empty() )
+			{
+				result = std::move( m_buffers.back() );
+				m_buffers.pop_back();
+			}
+
+			return result;
+		}
+
+		//! Return a buffer to the pool.
+		void
+		release( std::string buffer ) noexcept
+		{
+			const auto capacity = buffer.capacity();
+			// Buffers without dynamically allocated memory aren't kept.
+			if( capacity > std::string{}.capacity() &&
+					capacity <= max_buffer_capacity &&
+					m_buffers.size() < max_buffers )
+			{
+				buffer.clear();
+				// Can't throw because the capacity is reserved in advance.
+				m_buffers.push_back( std::move( buffer ) );
+			}
+		}
+
+	private:
+		std::vector< std::string > m_buffers;
+};
+
+//
+// thread_local_output_buffer_pool()
+//
+/*!
+ * @brief Get the pool for the current thread.
+ *
+ * @return nullptr if the pool for the current thread is already
+ * destroyed (it's possible if a buffer is released during the shutdown
+ * of the thread).
+ *
+ * @since v.0.7.10
+ */
+[[nodiscard]]
+inline output_buffer_pool_t *
+thread_local_output_buffer_pool()
+{
+	struct holder_t
+	{
+		bool & m_destroyed;
+		output_buffer_pool_t m_pool;
+
+		~holder_t() { m_destroyed = true; }
+	};
+
+	thread_local bool destroyed = false;
+	if( destroyed )
+		return nullptr;
+
+	thread_local holder_t holder{ destroyed, {} };
+	return &holder.m_pool;
+}
+
+//
+// pooled_string_buffer_t
+//
+/*!
+ * @brief A string buffer that is returned to the per-thread pool
+ * at the destruction.
+ *
+ * Can be used as Datasizeable for writable_item_t.
+ *
+ * @since v.0.7.10
+ */
+class pooled_string_buffer_t
+{
+	public:
+		//! Take a buffer from the pool of the current thread.
+		pooled_string_buffer_t()
+		{
+			if( auto * pool = thread_local_output_buffer_pool() )
+				m_buffer = pool->acquire();
+		}
+
+		pooled_string_buffer_t( pooled_string_buffer_t && o ) noexcept
+			:	m_buffer{ std::exchange( o.m_buffer, std::string{} ) }
+		{}
+
+		pooled_string_buffer_t &
+		operator=( pooled_string_buffer_t && o ) noexcept
+		{
+			if( this != &o )
+			{
+				release_buffer();
+				m_buffer = std::exchange( o.m_buffer, std::string{} );
+			}
+
+			return *this;
+		}
+
+		~pooled_string_buffer_t()
+		{
+			release_buffer();
+		}
+
+		//! Access to the underlying string.
+		[[nodiscard]]
+		std::string &
+		str() noexcept { return m_buffer; }
+
+		[[nodiscard]]
+		const char *
+		data() const noexcept { return m_buffer.data(); }
+
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept { return m_buffer.size(); }
+
+	private:
+		std::string m_buffer;
+
+		void
+		release_buffer() noexcept
+		{
+			// NOTE: thread_local_output_buffer_pool() can throw only
+			// at the creation of the pool.
+			restinio::utils::suppress_exceptions_quietly( [this] {
+					if( auto * pool = thread_local_output_buffer_pool() )
+						pool->release( std::move( m_buffer ) );
+				} );
+		}
+};
+
+} /* namespace impl */
+
+} /* namespace restinio */
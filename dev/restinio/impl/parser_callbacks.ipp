@@ -52,13 +52,16 @@ restinio_header_field_cb( llhttp_t * parser, const char *at, size_t length )
 			return -1;
 		}
 
-		if( ctx->m_current_field_name.size() + length >
+		if( ctx->m_current_header_field_name.size() + length >
 				ctx->m_limits.max_field_name_size() )
 		{
 			return -1;
 		}
 
-		ctx->m_current_field_name.append( at, length );
+		// NOTE: since v.0.7.10 the name isn't copied here.
+		// Only a view to the input buffer is stored if the whole
+		// name is in the buffer.
+		ctx->m_current_header_field_name.append( at, length );
 	}
 	catch( const std::exception & )
 	{
@@ -70,24 +73,31 @@ restinio_header_field_cb( llhttp_t * parser, const char *at, size_t length )
 
 inline int
 restinio_header_field_complete_cb( llhttp_t * parser )
+{
+	// NOTE: since v.0.7.10 the field is added to the header
+	// only when its value is completed.
+	// At this point the number of parsed fields can be incremented.
+	get_http_parser_ctx( parser )->m_total_field_count += 1u;
+
+	return 0;
+}
+
+inline int
+restinio_header_value_cb( llhttp_t * parser, const char *at, size_t length )
 {
 	try
 	{
 		auto * ctx = get_http_parser_ctx( parser );
 
-		auto & fields = ctx->m_leading_headers_completed
-				? ctx->m_chunked_info_block.m_trailing_fields
-				: ctx->m_header;
+		if( ctx->m_last_value_total_size + length >=
+				ctx->m_limits.max_field_value_size() )
+		{
+			return -1;
+		}
 
-		// Note: moving `ctx->m_current_field_name`
-		//       also cleans the placeholder, so it
-		//       becomes ready to accumulating next field.
-		fields.add_field(
-			std::move( ctx->m_current_field_name ),
-			std::string{} );
+		ctx->m_last_value_total_size += length;
 
-		// At this point the number of parsed fields can be incremented.
-		ctx->m_total_field_count += 1u;
+		ctx->m_current_header_field_value.append( at, length );
 	}
 	catch( const std::exception & )
 	{
@@ -97,33 +107,28 @@ restinio_header_field_complete_cb( llhttp_t * parser )
 	return 0;
 }
 
-
-inline void
-append_last_field_accessor( http_header_fields_t & fields, string_view_t value )
-{
-	fields.append_last_field( value );
-}
-
 inline int
-restinio_header_value_cb( llhttp_t * parser, const char *at, size_t length )
+restinio_header_value_complete_cb( llhttp_t * parser )
 {
 	try
 	{
 		auto * ctx = get_http_parser_ctx( parser );
 
-		http_header_fields_t & fields = ctx->m_leading_headers_completed
+		auto & fields = ctx->m_leading_headers_completed
 				? ctx->m_chunked_info_block.m_trailing_fields
 				: ctx->m_header;
 
-		if( ctx->m_last_value_total_size + length >=
-				ctx->m_limits.max_field_value_size() )
-		{
-			return -1;
-		}
+		// The name and the value are copied into the final storage
+		// here (and only here if they were received at once).
+		fields.add_field( http_header_field_t{
+				ctx->m_current_header_field_name.view(),
+				ctx->m_current_header_field_value.view() } );
 
-		ctx->m_last_value_total_size += length;
+		ctx->m_current_header_field_name.clear();
+		ctx->m_current_header_field_value.clear();
 
-		append_last_field_accessor( fields, std::string{ at, length } );
+		// Reset value size counter for the next time.
+		ctx->m_last_value_total_size = 0;
 	}
 	catch( const std::exception & )
 	{
@@ -133,14 +138,6 @@ restinio_header_value_cb( llhttp_t * parser, const char *at, size_t length )
 	return 0;
 }
 
-inline int
-restinio_header_value_complete_cb( llhttp_t * parser )
-{
-	// Reset value size counter for the next time.
-	get_http_parser_ctx( parser )->m_last_value_total_size = 0;
-	return 0;
-}
-
 inline int
 restinio_headers_complete_cb( llhttp_t * parser )
 {
@@ -160,7 +157,7 @@ restinio_headers_complete_cb( llhttp_t * parser )
 
 		try
 		{
-			ctx->m_body.reserve(
+			ctx->expect_body(
 					::restinio::utils::impl::uint64_to_size_t(
 							parser->content_length) );
 		}
@@ -183,13 +180,13 @@ restinio_body_cb( llhttp_t * parser, const char *at, size_t length )
 
 		// The total size of the body should be checked.
 		const auto total_length = static_cast<std::uint64_t>(
-				ctx->m_body.size() ) + length;
+				ctx->body_size() ) + length;
 		if( total_length > ctx->m_limits.max_body_size() )
 		{
 			return -1;
 		}
 
-		ctx->m_body.append( at, length );
+		ctx->append_body( at, length );
 	}
 	catch( const std::exception & )
 	{
@@ -217,7 +214,7 @@ restinio_chunk_header_cb( llhttp_t * parser )
 			// the incoming request the whole request's data will be dropped.
 			// So there is no need to care about that new item in m_chunks.
 			ctx->m_chunked_info_block.m_chunks.emplace_back(
-				ctx->m_body.size(),
+				ctx->body_size(),
 				::restinio::utils::impl::uint64_to_size_t(parser->content_length),
 				std::move( ctx->m_chunk_ext_params ) );
 		}
@@ -80,6 +80,20 @@ class response_context_t
 		//! Is context empty.
 		bool empty() const noexcept { return m_write_groups.empty(); }
 
+		//! Get the first write group in data queue.
+		/*!
+		 * @attention
+		 * The context must not be empty.
+		 *
+		 * @since v.0.7.10
+		 */
+		const write_group_t &
+		front_group() const noexcept
+		{
+			assert( !m_write_groups.empty() );
+			return m_write_groups.front();
+		}
+
 		//! Extract write group from data queue.
 		write_group_t
 		dequeue_group() noexcept
@@ -408,6 +422,43 @@ class response_coordinator_t
 			return result;
 		}
 
+		//! Extract a portion of data that can be written together with
+		//! already extracted data.
+		/*!
+			Works like pop_ready_buffers() but extracts the next write group
+			only if it consists of trivial buffers only and fits into
+			the specified limits. It allows to send ready responses for
+			several pipelined requests by one gather write operation.
+
+			Returns an empty optional if there is no such group or
+			the coordinator is closed.
+
+			@since v.0.7.10
+		*/
+		std::optional< std::pair< write_group_t, request_id_t > >
+		pop_ready_trivial_buffers(
+			//! Max count of buffers in the group.
+			std::size_t max_items,
+			//! Max total size of buffers in the group.
+			std::size_t max_bytes )
+		{
+			std::optional< std::pair< write_group_t, request_id_t > > result;
+
+			if( !closed() && !m_context_table.empty() )
+			{
+				const auto & current_ctx = m_context_table.front();
+
+				if( !current_ctx.empty() &&
+						fits_into_limits(
+								current_ctx.front_group(), max_items, max_bytes ) )
+				{
+					result = pop_ready_buffers();
+				}
+			}
+
+			return result;
+		}
+
 		//! Remove all contexts.
 		/*!
 			Invoke write groups after-write callbacks with error status.
@@ -447,6 +498,32 @@ class response_coordinator_t
 		}
 
 	private:
+		//! Does the group consist of trivial buffers only and fits
+		//! into the limits?
+		static bool
+		fits_into_limits(
+			const write_group_t & wg,
+			std::size_t max_items,
+			std::size_t max_bytes )
+		{
+			if( wg.items_count() > max_items )
+				return false;
+
+			std::size_t total_size{ 0 };
+			for( const auto & item : wg.items() )
+			{
+				if( writable_item_type_t::trivial_write_operation !=
+						item.write_type() )
+					return false;
+
+				total_size += item.size();
+				if( total_size > max_bytes )
+					return false;
+			}
+
+			return true;
+		}
+
 		//! Counter for asigining id to new requests.
 		request_id_t m_request_id_counter{ 0 };
 
@@ -0,0 +1,300 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Hierarchical timer wheel.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace restinio
+{
+
+namespace impl
+{
+
+//
+// timer_wheel_node_t
+//
+/*!
+ * @brief A base class for entries of timer_wheel_t.
+ *
+ * Nodes are linked into intrusive doubly-linked lists, so there is no
+ * need for any allocation for scheduling or canceling a timer.
+ *
+ * @attention
+ * A node can't be copied or moved. A linked node has to be removed from
+ * the wheel before its destruction.
+ *
+ * @since v.0.7.10
+ */
+class timer_wheel_node_t
+{
+	friend class timer_wheel_t;
+
+	timer_wheel_node_t * m_prev{ nullptr };
+	timer_wheel_node_t * m_next{ nullptr };
+
+	//! The tick when the timer expires.
+	std::uint64_t m_expires_at{ 0u };
+
+	void
+	link_after( timer_wheel_node_t & head ) noexcept
+	{
+		m_prev = &head;
+		m_next = head.m_next;
+		head.m_next->m_prev = this;
+		head.m_next = this;
+	}
+
+	void
+	unlink() noexcept
+	{
+		m_prev->m_next = m_next;
+		m_next->m_prev = m_prev;
+		m_prev = m_next = nullptr;
+	}
+
+public:
+	timer_wheel_node_t() noexcept = default;
+
+	timer_wheel_node_t( const timer_wheel_node_t & ) = delete;
+	timer_wheel_node_t & operator=( const timer_wheel_node_t & ) = delete;
+
+	//! Is the node scheduled in a wheel?
+	[[nodiscard]]
+	bool
+	is_linked() const noexcept { return nullptr != m_next; }
+
+	//! The tick when the timer expires.
+	[[nodiscard]]
+	std::uint64_t
+	expires_at() const noexcept { return m_expires_at; }
+};
+
+//
+// timer_wheel_t
+//
+/*!
+ * @brief Hierarchical timer wheel.
+ *
+ * Time is measured in ticks. The wheel has several levels of slots,
+ * every slot on level N covers 64^N ticks. A timer is placed into
+ * a slot of the lowest level that covers its expiration time. When
+ * the wheel turns through all slots of level N the next slot of level
+ * N+1 is cascaded: its timers are moved into lower levels.
+ *
+ * Schedule and cancel are O(1) operations without any allocations.
+ * Timers that expire later than the wheel's span are placed into the last
+ * slot of the top level and are rescheduled during cascading.
+ *
+ * @note
+ * This class isn't thread safe.
+ *
+ * @since v.0.7.10
+ */
+class timer_wheel_t
+{
+public:
+	static constexpr unsigned int slot_bits = 6u;
+	static constexpr std::uint64_t slots_per_level = 1u << slot_bits;
+	static constexpr std::uint64_t slot_mask = slots_per_level - 1u;
+	static constexpr unsigned int levels = 4u;
+
+	//! Max distance (in ticks) to the expiration point.
+	static constexpr std::uint64_t max_span =
+			std::uint64_t{ 1u } << (slot_bits * levels);
+
+	timer_wheel_t( const timer_wheel_t & ) = delete;
+	timer_wheel_t & operator=( const timer_wheel_t & ) = delete;
+
+	explicit timer_wheel_t( std::uint64_t current_tick = 0u ) noexcept
+		:	m_current_tick{ current_tick }
+	{
+		for( auto & level : m_slots )
+			for( auto & head : level )
+				head.m_prev = head.m_next = &head;
+	}
+
+	//! The current tick of the wheel.
+	[[nodiscard]]
+	std::uint64_t
+	current_tick() const noexcept { return m_current_tick; }
+
+	//! Count of scheduled timers.
+	[[nodiscard]]
+	std::size_t
+	size() const noexcept { return m_size; }
+
+	[[nodiscard]]
+	bool
+	empty() const noexcept { return 0u == m_size; }
+
+	//! Schedule a timer.
+	/*!
+	 * If the node is already scheduled then it's rescheduled.
+	 *
+	 * If @a expires_at is not greater than the current tick then
+	 * the timer expires at the next tick.
+	 */
+	void
+	schedule( timer_wheel_node_t & node, std::uint64_t expires_at ) noexcept
+	{
+		if( node.is_linked() )
+			cancel( node );
+
+		node.m_expires_at = expires_at > m_current_tick ?
+				expires_at : m_current_tick + 1u;
+		place( node );
+		++m_size;
+	}
+
+	//! Remove a timer from the wheel.
+	/*!
+	 * Does nothing if the node isn't scheduled.
+	 */
+	void
+	cancel( timer_wheel_node_t & node ) noexcept
+	{
+		if( node.is_linked() )
+		{
+			node.unlink();
+			--m_size;
+		}
+	}
+
+	//! Turn the wheel up to @a target_tick.
+	/*!
+	 * Every expired timer is removed from the wheel and then passed to
+	 * @a on_expired. The callback can schedule the node again.
+	 *
+	 * @note
+	 * The callback has to be noexcept.
+	 */
+	template< typename On_Expired >
+	void
+	advance( std::uint64_t target_tick, On_Expired && on_expired ) noexcept
+	{
+		while( m_current_tick < target_tick )
+		{
+			if( empty() )
+			{
+				// There is no need to turn an empty wheel tick by tick.
+				m_current_tick = target_tick;
+				break;
+			}
+
+			++m_current_tick;
+			cascade();
+
+			auto & head = m_slots[ 0u ][ m_current_tick & slot_mask ];
+			while( head.m_next != &head )
+			{
+				auto & node = *(head.m_next);
+				node.unlink();
+				--m_size;
+				on_expired( node );
+			}
+		}
+	}
+
+	//! Get the tick at which advance() should be called next time.
+	/*!
+	 * It's the tick of the nearest non-empty slot of the lowest level
+	 * or the tick when the next cascading should be performed.
+	 *
+	 * @attention
+	 * Must not be called for an empty wheel.
+	 */
+	[[nodiscard]]
+	std::uint64_t
+	next_tick_to_advance() const noexcept
+	{
+		const auto & level = m_slots[ 0u ];
+		std::uint64_t tick = m_current_tick + 1u;
+		for( ; 0u != (tick & slot_mask); ++tick )
+		{
+			const auto & head = level[ tick & slot_mask ];
+			if( head.m_next != &head )
+				return tick;
+		}
+
+		return tick;
+	}
+
+private:
+	using level_t = std::array< timer_wheel_node_t, slots_per_level >;
+
+	std::array< level_t, levels > m_slots;
+
+	std::uint64_t m_current_tick;
+
+	std::size_t m_size{ 0u };
+
+	//! Put the node into the appropriate slot.
+	void
+	place( timer_wheel_node_t & node ) noexcept
+	{
+		const std::uint64_t delta = node.m_expires_at - m_current_tick;
+
+		for( unsigned int level = 0u; level != levels; ++level )
+		{
+			const unsigned int shift = slot_bits * (level + 1u);
+			if( delta < (std::uint64_t{ 1u } << shift) )
+			{
+				node.link_after( m_slots[ level ][
+						(node.m_expires_at >> (slot_bits * level)) & slot_mask ] );
+				return;
+			}
+		}
+
+		// The expiration time is too far. The timer will be
+		// replaced during the cascading of the last slot of the top level.
+		constexpr unsigned int top = levels - 1u;
+		node.link_after( m_slots[ top ][
+				((m_current_tick >> (slot_bits * top)) - 1u) & slot_mask ] );
+	}
+
+	//! Move timers from higher levels to lower ones if it's time.
+	void
+	cascade() noexcept
+	{
+		for( unsigned int level = 1u; level != levels; ++level )
+		{
+			const unsigned int shift = slot_bits * level;
+			if( 0u != (m_current_tick & ((std::uint64_t{ 1u } << shift) - 1u)) )
+				break;
+
+			auto & head = m_slots[ level ][ (m_current_tick >> shift) & slot_mask ];
+
+			// Timers are extracted to the temporary list first because
+			// they can be placed back to the same slot.
+			timer_wheel_node_t tmp;
+			tmp.m_prev = tmp.m_next = &tmp;
+			while( head.m_next != &head )
+			{
+				auto & node = *(head.m_next);
+				node.unlink();
+				node.link_after( tmp );
+			}
+
+			while( tmp.m_next != &tmp )
+			{
+				auto & node = *(tmp.m_next);
+				node.unlink();
+				place( node );
+			}
+		}
+	}
+};
+
+} /* namespace impl */
+
+} /* namespace restinio */
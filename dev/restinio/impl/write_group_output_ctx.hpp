@@ -12,10 +12,16 @@
 
 #include <restinio/buffers.hpp>
 #include <restinio/impl/sendfile_operation.hpp>
+#include <restinio/impl/output_buffer_pool.hpp>
 
 #include <restinio/compiler_features.hpp>
 
+#include <restinio/utils/suppress_exceptions.hpp>
+#include <restinio/utils/small_vector.hpp>
+
+#include <algorithm>
 #include <optional>
+#include <string>
 #include <variant>
 #include <vector>
 
@@ -25,7 +31,22 @@ namespace restinio
 namespace impl
 {
 
-using asio_bufs_container_t = std::vector< asio_ns::const_buffer >;
+//! The maximum number of buffers that can be written with
+//! gather write operation.
+/*!
+	@since v.0.7.10
+*/
+constexpr std::size_t max_asio_bufs_per_write =
+	std::min< std::size_t >( asio_ns::detail::max_iov_len, 64u );
+
+//! Container for asio buffers of a write operation.
+/*!
+	@note
+	Since v.0.7.10 buffers are stored inline, so there is no memory
+	allocation for the container.
+*/
+using asio_bufs_container_t =
+	utils::small_vector_t< asio_ns::const_buffer, max_asio_bufs_per_write >;
 
 //
 // write_group_output_ctx_t
@@ -83,20 +104,35 @@ class write_group_output_ctx_t
 	static constexpr auto
 	max_iov_len() noexcept
 	{
-		using len_t = decltype( asio_ns::detail::max_iov_len );
 		return static_cast< asio_bufs_container_t::size_type >(
-				std::min< len_t >( asio_ns::detail::max_iov_len, 64 ) );
+				max_asio_bufs_per_write );
 	}
 
 	public:
+		//! Max total size of write groups that are coalesced into
+		//! one gather write operation.
+		/*!
+			@since v.0.7.10
+		*/
+		static constexpr std::size_t max_coalesced_bytes = 64u * 1024u;
+
 		//! Contruct an object.
 		/*
-			Space for m_asio_bufs is reserved to be ready to store max_iov_len() asio bufs.
+			Since v.0.7.10 there is no need to reserve space for m_asio_bufs
+			because it has an inline storage for max_iov_len() asio bufs.
+		*/
+		write_group_output_ctx_t() = default;
+
+		//! How many buffers and bytes can be added to the current
+		//! write operation.
+		/*!
+			@since v.0.7.10
 		*/
-		write_group_output_ctx_t()
+		struct coalescing_capacity_t
 		{
-			m_asio_bufs.reserve( max_iov_len() );
-		}
+			std::size_t m_items;
+			std::size_t m_bytes;
+		};
 
 		//! Trivial write operaton.
 		/*!
@@ -108,7 +144,7 @@ class write_group_output_ctx_t
 
 				explicit trivial_write_operation_t(
 					//! Container of asio buf objects.
-					const asio_bufs_container_t & asio_bufs,
+					asio_bufs_container_t & asio_bufs,
 					//! Total size of data represented by buffers.
 					std::size_t total_size ) noexcept
 					:	m_asio_bufs{ &asio_bufs }
@@ -123,7 +159,7 @@ class write_group_output_ctx_t
 				trivial_write_operation_t & operator = ( trivial_write_operation_t && ) = default;
 
 				//! Get buffer "iovec" for performing gather write.
-				const std::vector< asio_ns::const_buffer > &
+				const asio_bufs_container_t &
 				get_trivial_bufs() const noexcept
 				{
 					return *m_asio_bufs;
@@ -132,8 +168,31 @@ class write_group_output_ctx_t
 				//! The size of data within this operation.
 				auto size() const noexcept { return m_total_size; }
 
+				//! Remove already written bytes from the buffers.
+				/*!
+					It's intended to be used after a partial write.
+
+					@since v.0.7.10
+				*/
+				void
+				consume( std::size_t bytes ) noexcept
+				{
+					assert( bytes <= m_total_size );
+					m_total_size -= bytes;
+
+					auto it = m_asio_bufs->begin();
+					for( ; 0u != bytes && it->size() <= bytes; ++it )
+						bytes -= it->size();
+
+					if( 0u != bytes )
+						*it += bytes;
+
+					// Can't throw because const_buffer is trivially copyable.
+					m_asio_bufs->erase( m_asio_bufs->begin(), it );
+				}
+
 			private:
-				const asio_bufs_container_t * m_asio_bufs;
+				asio_bufs_container_t * m_asio_bufs;
 				size_t m_total_size;
 		};
 
@@ -223,6 +282,78 @@ class write_group_output_ctx_t
 				sendfile_operation_shared_ptr_t * m_sendfile_operation;
 		};
 
+		//! Write operation for data pulled from a body generator.
+		/*!
+			Every piece of data is placed into the same buffer, so the next
+			piece can be requested only after the previous one is written.
+
+			@since v.0.7.10
+		*/
+		class generator_write_operation_t
+		{
+				friend class write_group_output_ctx_t;
+
+				explicit generator_write_operation_t(
+					body_generator_t & generator,
+					std::optional< pooled_string_buffer_t > & buffer ) noexcept
+					:	m_generator{ &generator }
+					,	m_buffer{ &buffer }
+				{}
+
+			public:
+				generator_write_operation_t( const generator_write_operation_t & ) = default;
+				generator_write_operation_t & operator = ( const generator_write_operation_t & ) = default;
+
+				generator_write_operation_t( generator_write_operation_t && ) = default;
+				generator_write_operation_t & operator = ( generator_write_operation_t && ) = default;
+
+				//! Get the next piece of data.
+				/*!
+					@return an empty buffer if all data is already generated.
+				*/
+				asio_ns::const_buffer
+				next_piece()
+				{
+					if( !*m_buffer )
+						m_buffer->emplace();
+
+					auto & str = (*m_buffer)->str();
+					if( str.size() != generated_data_buffer_size )
+						str.resize( generated_data_buffer_size );
+
+					const auto size = m_generator->next( str.data(), str.size() );
+
+					return asio_ns::const_buffer{ str.data(), size };
+				}
+
+				//! Get the size of data that isn't generated yet.
+				auto remaining() const noexcept { return m_generator->remaining(); }
+
+				//! Get the total size of generated data.
+				auto size() const noexcept { return m_generator->size(); }
+
+			private:
+				//! A pointer to the generator.
+				body_generator_t * m_generator; // Pointer is used to be able to copy/assign.
+
+				//! A buffer for generated data.
+				/*!
+					This buffer is owned by write_group_output_ctx_t and
+					is shared by all generators of the write group.
+				*/
+				std::optional< pooled_string_buffer_t > * m_buffer;
+		};
+
+		//! Size of the buffer for data pulled from body generators.
+		/*!
+			It's not greater than the max capacity of buffers kept in
+			the output buffer pool, so the buffer is reused.
+
+			@since v.0.7.10
+		*/
+		static constexpr std::size_t generated_data_buffer_size =
+			output_buffer_pool_t::max_buffer_capacity;
+
 		//! None write operation.
 		/*!
 			When extract_next_write_operation() returns a variant with
@@ -235,10 +366,97 @@ class write_group_output_ctx_t
 		bool transmitting() const noexcept { return static_cast< bool >( m_current_wg ); }
 
 		//! Start handlong next write group.
+		/*!
+			@note
+			Since v.0.7.10 this method isn't noexcept because the size of
+			the group is calculated for coalescing of write groups.
+		*/
 		void
-		start_next_write_group( std::optional< write_group_t > next_wg ) noexcept
+		start_next_write_group( std::optional< write_group_t > next_wg )
 		{
 			m_current_wg = std::move( next_wg );
+			m_coalescing_capacity = coalescing_capacity_t{ 0u, 0u };
+
+			// Other groups can be written together with the current one
+			// only if it has trivial buffers only and doesn't require
+			// several write operations.
+			if( m_current_wg &&
+					0u != m_current_wg->items_count() &&
+					max_iov_len() >= m_current_wg->items_count() )
+			{
+				std::size_t total_size{ 0 };
+				for( const auto & item : m_current_wg->items() )
+				{
+					if( writable_item_type_t::trivial_write_operation !=
+							item.write_type() )
+						return;
+					total_size += item.size();
+				}
+
+				if( max_coalesced_bytes >= total_size )
+				{
+					m_coalescing_capacity = coalescing_capacity_t{
+							max_iov_len() - m_current_wg->items_count(),
+							max_coalesced_bytes - total_size
+						};
+				}
+			}
+		}
+
+		//! Get the capacity for groups to be written together with
+		//! the current one.
+		/*!
+			Zero capacity means that there is no room for other groups.
+
+			@since v.0.7.10
+		*/
+		coalescing_capacity_t
+		coalescing_capacity() const noexcept
+		{
+			return m_coalescing_capacity;
+		}
+
+		//! Add a group to be written together with the current one.
+		/*!
+			The group must consist of trivial buffers only and fit
+			into coalescing_capacity().
+
+			The after-write notificators of all groups are invoked in
+			the order of groups.
+
+			@since v.0.7.10
+		*/
+		void
+		append_write_group( write_group_t wg )
+		{
+			assert( m_current_wg );
+			assert( 0u == m_next_writable_item_index );
+
+			std::size_t total_size{ 0 };
+			for( const auto & item : wg.items() )
+			{
+				assert( writable_item_type_t::trivial_write_operation ==
+						item.write_type() );
+				total_size += item.size();
+			}
+
+			assert( m_coalescing_capacity.m_items >= wg.items_count() );
+			assert( m_coalescing_capacity.m_bytes >= total_size );
+
+			m_coalescing_capacity.m_items -= wg.items_count();
+			m_coalescing_capacity.m_bytes -= total_size;
+
+			m_coalesced_wgs.emplace_back( std::move( wg ) );
+		}
+
+		//! Get the count of groups added by append_write_group().
+		/*!
+			@since v.0.7.10
+		*/
+		std::size_t
+		coalesced_groups_count() const noexcept
+		{
+			return m_coalesced_wgs.size();
 		}
 
 		//! An alias for variant holding write operation specifics.
@@ -246,7 +464,8 @@ class write_group_output_ctx_t
 			std::variant<
 				none_write_operation_t,
 				trivial_write_operation_t,
-				file_write_operation_t >;
+				file_write_operation_t,
+				generator_write_operation_t >;
 
 		//! Get an object with next write operation to perform.
 		solid_write_operation_variant_t
@@ -267,12 +486,18 @@ class write_group_output_ctx_t
 					// Trivial buffers.
 					result = prepare_trivial_buffers_wo();
 				}
-				else
+				else if( writable_item_type_t::file_write_operation == next_wi_type )
 				{
 					// Sendfile.
-					assert( writable_item_type_t::file_write_operation == next_wi_type );
 					result = prepare_sendfile_wo();
 				}
+				else
+				{
+					// Body generator.
+					assert( writable_item_type_t::generator_write_operation ==
+							next_wi_type );
+					result = prepare_generator_wo();
+				}
 			}
 
 			return result;
@@ -286,7 +511,9 @@ class write_group_output_ctx_t
 
 			invoke_after_write_notificator_if_necessary( ec );
 			m_current_wg.reset();
+			m_coalesced_wgs.clear();
 			m_sendfile_operation.reset();
+			m_generated_data_buffer.reset();
 		}
 
 		//! Finish writing group normally.
@@ -305,18 +532,42 @@ class write_group_output_ctx_t
 		reset_write_group()
 		{
 			m_current_wg.reset();
+			m_coalesced_wgs.clear();
 			m_next_writable_item_index = 0;
+			// The buffer is returned to the pool to be reused by other
+			// connections of the same thread.
+			m_generated_data_buffer.reset();
 		}
 
 		//! Execute notification callback if necessary.
+		/*!
+			@note
+			Since v.0.7.10 notificators of coalesced groups are invoked
+			too. All notificators are invoked even if some of them throw.
+		*/
 		void
 		invoke_after_write_notificator_if_necessary( const asio_ns::error_code & ec )
 		{
-			try
-			{
-				m_current_wg->invoke_after_write_notificator_if_exists( ec );
-			}
-			catch( const std::exception & ex )
+			std::optional< std::string > error;
+
+			const auto invoke = [&]( write_group_t & wg ) noexcept {
+					try
+					{
+						wg.invoke_after_write_notificator_if_exists( ec );
+					}
+					catch( const std::exception & ex )
+					{
+						if( !error )
+							restinio::utils::suppress_exceptions_quietly(
+									[&]{ error = ex.what(); } );
+					}
+				};
+
+			invoke( *m_current_wg );
+			for( auto & wg : m_coalesced_wgs )
+				invoke( wg );
+
+			if( error )
 			{
 				// Actualy no need to reset m_current_wg as a thrown exception
 				// will break working circle of connection.
@@ -327,7 +578,7 @@ class write_group_output_ctx_t
 				throw exception_t{
 					fmt::format(
 						RESTINIO_FMT_FORMAT_STRING( "after write callback failed: {}" ),
-						ex.what() ) };
+						*error ) };
 			}
 		}
 
@@ -351,6 +602,18 @@ class write_group_output_ctx_t
 				total_size += item.size();
 			}
 
+			// Since v.0.7.10 buffers of coalesced groups are written by
+			// the same operation. They always fit into max_iov_len().
+			if( m_next_writable_item_index == items.size() )
+			{
+				for( const auto & wg : m_coalesced_wgs )
+					for( const auto & item : wg.items() )
+					{
+						m_asio_bufs.emplace_back( item.buf() );
+						total_size += item.size();
+					}
+			}
+
 			assert( !m_asio_bufs.empty() );
 			return trivial_write_operation_t{ m_asio_bufs, total_size };
 		}
@@ -365,6 +628,19 @@ class write_group_output_ctx_t
 			return file_write_operation_t{ sf, m_sendfile_operation };
 		}
 
+		//! Prepare write operation for body generator.
+		/*!
+			@since v.0.7.10
+		*/
+		generator_write_operation_t
+		prepare_generator_wo()
+		{
+			auto & generator =
+				m_current_wg->items()[ m_next_writable_item_index++ ].body_generator();
+
+			return generator_write_operation_t{ generator, m_generated_data_buffer };
+		}
+
 		//! Real buffers with data.
 		std::optional< write_group_t > m_current_wg;
 
@@ -380,6 +656,27 @@ class write_group_output_ctx_t
 
 		//! Sendfile operation storage context.
 		sendfile_operation_shared_ptr_t m_sendfile_operation;
+
+		//! Buffer for data pulled from body generators.
+		/*!
+			It's taken from the output buffer pool only when a body
+			generator is written.
+
+			@since v.0.7.10
+		*/
+		std::optional< pooled_string_buffer_t > m_generated_data_buffer;
+
+		//! Groups to be written together with the current group.
+		/*!
+			@since v.0.7.10
+		*/
+		std::vector< write_group_t > m_coalesced_wgs;
+
+		//! Capacity for groups to be written with the current group.
+		/*!
+			@since v.0.7.10
+		*/
+		coalescing_capacity_t m_coalescing_capacity{ 0u, 0u };
 };
 
 } /* namespace impl */
@@ -17,9 +17,11 @@
 #include <restinio/http_headers.hpp>
 #include <restinio/os.hpp>
 #include <restinio/sendfile.hpp>
+#include <restinio/header_template.hpp>
 #include <restinio/impl/connection_base.hpp>
 
 #include <restinio/impl/header_helpers.hpp>
+#include <restinio/impl/output_buffer_pool.hpp>
 
 namespace restinio
 {
@@ -65,6 +67,67 @@ make_date_field_value( std::chrono::system_clock::time_point tp )
 	return make_date_field_value( std::chrono::system_clock::to_time_t( tp ) );
 }
 
+namespace impl
+{
+
+//
+// date_field_value_cache_t
+//
+/*!
+ * @brief A cache for the value of `Date` field.
+ *
+ * The value is formatted again only if the current time (with
+ * one second precision) differs from the time of the cached value.
+ *
+ * @note
+ * This class isn't thread safe, there is a separate instance for every
+ * thread (see cached_date_field_value()).
+ *
+ * @since v.0.7.10
+ */
+class date_field_value_cache_t
+{
+	public:
+		//! Get the value for the current time.
+		[[nodiscard]]
+		const std::string &
+		value()
+		{
+			const auto now = std::chrono::system_clock::to_time_t(
+					std::chrono::system_clock::now() );
+			if( now != m_time || m_value.empty() )
+			{
+				m_value = make_date_field_value( now );
+				m_time = now;
+			}
+
+			return m_value;
+		}
+
+	private:
+		std::time_t m_time{};
+		std::string m_value;
+};
+
+//
+// cached_date_field_value()
+//
+/*!
+ * @brief Get the value of `Date` field for the current time from
+ * the per-thread cache.
+ *
+ * @since v.0.7.10
+ */
+[[nodiscard]]
+inline const std::string &
+cached_date_field_value()
+{
+	thread_local date_field_value_cache_t cache;
+	return cache.value();
+}
+
+} /* namespace impl */
+
 //
 // base_response_builder_t
 //
@@ -89,6 +152,7 @@ class base_response_builder_t
 			:	m_header{ std::move( status_line ) }
 			,	m_connection{ std::move( connection ) }
 			,	m_request_id{ request_id }
+			,	m_auto_date_field{ m_connection && m_connection->auto_date_field() }
 		{
 			m_header.should_keep_alive( should_keep_alive );
 		}
@@ -171,11 +235,29 @@ class base_response_builder_t
 		}
 
 
+		//! Add header `Date` field with the current time.
+		/*!
+		 * @note
+		 * Since v.0.7.10 the value is taken from a per-thread cache
+		 * that is updated at most once per second.
+		 */
+		Response_Builder &
+		append_header_date_field() &
+		{
+			m_header.set_field( http_field_t::date, impl::cached_date_field_value() );
+			return upcast_reference();
+		}
+
+		//! Add header `Date` field with the current time.
+		Response_Builder &&
+		append_header_date_field() &&
+		{
+			return std::move( this->append_header_date_field() );
+		}
+
 		//! Add header `Date` field.
 		Response_Builder &
-		append_header_date_field(
-			std::chrono::system_clock::time_point tp =
-				std::chrono::system_clock::now() ) &
+		append_header_date_field( std::chrono::system_clock::time_point tp ) &
 		{
 			m_header.set_field( http_field_t::date, make_date_field_value( tp ) );
 			return upcast_reference();
@@ -183,9 +265,7 @@ class base_response_builder_t
 
 		//! Add header `Date` field.
 		Response_Builder &&
-		append_header_date_field(
-			std::chrono::system_clock::time_point tp =
-				std::chrono::system_clock::now() ) &&
+		append_header_date_field( std::chrono::system_clock::time_point tp ) &&
 		{
 			return std::move( this->append_header_date_field( tp ) );
 		}
@@ -220,6 +300,30 @@ class base_response_builder_t
 			return std::move( this->connection_keep_alive() );
 		}
 
+		//! Use pre-serialized header fields.
+		/*!
+		 * Fields from @a tmpl are sent after fields of the header.
+		 * A template set by a previous call is replaced.
+		 *
+		 * @since v.0.7.10
+		 */
+		Response_Builder &
+		use_header_template( header_template_t tmpl ) & noexcept
+		{
+			m_header_template = std::move( tmpl );
+			return upcast_reference();
+		}
+
+		//! Use pre-serialized header fields.
+		/*!
+		 * @since v.0.7.10
+		 */
+		Response_Builder &&
+		use_header_template( header_template_t tmpl ) && noexcept
+		{
+			return std::move( this->use_header_template( std::move( tmpl ) ) );
+		}
+
 	protected:
 		std::size_t
 		calculate_status_line_size() const noexcept
@@ -228,11 +332,61 @@ class base_response_builder_t
 			return 8 + 1 + 3 + 1 + m_header.status_line().reason_phrase().size();
 		}
 
+		//! Serialize the header into the first item of @a parts.
+		/*!
+		 * The first item must be reserved for the header. If a header
+		 * template is used then its buffer is inserted right after
+		 * the first item.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		put_header_items(
+			writable_items_container_t & parts,
+			impl::content_length_field_presence_t content_length_field_presence )
+		{
+			if( m_auto_date_field && !m_header.has_field( http_field_t::date ) )
+				m_header.add_field(
+						http_field_t::date, impl::cached_date_field_value() );
+
+			if( !m_header_template )
+			{
+				parts[ 0 ] = writable_item_t{
+						impl::create_header_string(
+							m_header,
+							content_length_field_presence ) };
+			}
+			else
+			{
+				parts[ 0 ] = writable_item_t{
+						impl::create_header_string(
+							m_header,
+							content_length_field_presence,
+							0u,
+							impl::final_crlf_presence_t::skip_final_crlf ) };
+				parts.insert(
+						std::next( parts.begin() ),
+						m_header_template.make_writable_item() );
+			}
+		}
+
 		http_response_header_t m_header;
 
+		//! Pre-serialized fields to be sent after the header.
+		/*!
+		 * @since v.0.7.10
+		 */
+		header_template_t m_header_template;
+
 		impl::connection_handle_t m_connection;
 		const request_id_t m_request_id;
 
+		//! Should `Date` field be added automatically?
+		/*!
+		 * @since v.0.7.10
+		 */
+		const bool m_auto_date_field;
+
 		void
 		throw_done_must_be_called_once() const
 		{
@@ -328,8 +482,9 @@ class response_builder_t< restinio_controlled_output_t > final
 
 				if_neccessary_reserve_first_element_for_header();
 
-				m_response_parts[ 0 ] =
-					writable_item_t{ impl::create_header_string( m_header ) };
+				put_header_items(
+						m_response_parts,
+						impl::content_length_field_presence_t::add_content_length );
 
 				write_group_t wg{ std::move( m_response_parts ) };
 				wg.status_line_size( calculate_status_line_size() );
@@ -402,6 +557,328 @@ class response_builder_t< restinio_controlled_output_t > final
 		writable_items_container_t m_response_parts;
 };
 
+//! Tag type for RESTinio controlled output response builder
+//! that serializes the header directly into the output buffer.
+/*!
+	@since v.0.7.10
+*/
+struct restinio_controlled_direct_output_t {};
+
+//! Response builder that serializes the header as fields are appended.
+/*!
+	It's a variant of response_builder_t<restinio_controlled_output_t>
+	for simple cases when a handler only appends header fields and sets
+	a body. There is no http_response_header_t object: the status line
+	and fields are written directly to an output buffer, so there are no
+	intermediate field objects and no second copy of the header.
+	Output buffers are taken from a per-thread pool and returned there
+	after the response is written, so in a steady state there is no
+	memory allocation for the header at all.
+
+	Content length is automatically calculated (like in
+	response_builder_t<restinio_controlled_output_t>).
+
+	Usage example:
+	@code
+	req->create_response< restinio::restinio_controlled_direct_output_t >()
+		.append_header( restinio::http_field::content_type, "application/json" )
+		.set_body( R"({"status":"ok"})" )
+		.done();
+	@endcode
+
+	@attention
+	Appended fields can't be read, modified or removed. Fields are not
+	checked for duplicates.
+
+	@since v.0.7.10
+*/
+template <>
+class response_builder_t< restinio_controlled_direct_output_t > final
+{
+	public:
+		using self_type_t =
+			response_builder_t< restinio_controlled_direct_output_t >;
+
+		//! Initial capacity for the header buffer.
+		static constexpr std::size_t initial_header_capacity = 256u;
+
+		response_builder_t( const response_builder_t & ) = delete;
+		response_builder_t & operator = ( const response_builder_t & ) = delete;
+
+		response_builder_t( response_builder_t && ) = default;
+
+		response_builder_t(
+			http_status_line_t status_line,
+			impl::connection_handle_t connection,
+			request_id_t request_id,
+			bool should_keep_alive )
+			:	m_connection{ std::move( connection ) }
+			,	m_request_id{ request_id }
+			,	m_should_keep_alive{ should_keep_alive }
+			,	m_auto_date_field{ m_connection && m_connection->auto_date_field() }
+		{
+			auto & buf = m_header.str();
+			buf.reserve( initial_header_capacity );
+
+			const auto & reason_phrase = status_line.reason_phrase();
+			if( const auto prebuilt = impl::find_prebuilt_status_line(
+						status_line.status_code(), reason_phrase );
+					!prebuilt.empty() )
+			{
+				buf.append( prebuilt.data(), prebuilt.size() );
+			}
+			else
+			{
+				impl::append_status_line(
+						buf, 1u, 1u, status_line.status_code(), reason_phrase );
+			}
+
+			// "HTTP/1.1 *** <reason-phrase>"
+			m_status_line_size = buf.size() - 2u;
+		}
+
+		//! Add header field.
+		self_type_t &
+		append_header( string_view_t field_name, string_view_t field_value ) &
+		{
+			if( impl::is_equal_caseless(
+					field_name, field_to_string( http_field_t::date ) ) )
+				m_has_date_field = true;
+
+			append_field( field_name, field_value );
+			return *this;
+		}
+
+		//! Add header field.
+		self_type_t &&
+		append_header( string_view_t field_name, string_view_t field_value ) &&
+		{
+			return std::move( this->append_header( field_name, field_value ) );
+		}
+
+		//! Add header field.
+		self_type_t &
+		append_header( http_field_t field_id, string_view_t field_value ) &
+		{
+			if( http_field_t::date == field_id )
+				m_has_date_field = true;
+
+			append_field( field_to_string( field_id ), field_value );
+			return *this;
+		}
+
+		//! Add header field.
+		self_type_t &&
+		append_header( http_field_t field_id, string_view_t field_value ) &&
+		{
+			return std::move( this->append_header( field_id, field_value ) );
+		}
+
+		//! Add header `Date` field with the current time.
+		self_type_t &
+		append_header_date_field() &
+		{
+			return append_header(
+					http_field_t::date, impl::cached_date_field_value() );
+		}
+
+		//! Add header `Date` field with the current time.
+		self_type_t &&
+		append_header_date_field() &&
+		{
+			return std::move( this->append_header_date_field() );
+		}
+
+		//! Add header `Date` field.
+		self_type_t &
+		append_header_date_field( std::chrono::system_clock::time_point tp ) &
+		{
+			return append_header( http_field_t::date, make_date_field_value( tp ) );
+		}
+
+		//! Add header `Date` field.
+		self_type_t &&
+		append_header_date_field( std::chrono::system_clock::time_point tp ) &&
+		{
+			return std::move( this->append_header_date_field( tp ) );
+		}
+
+		//! Use pre-serialized header fields.
+		/*!
+		 * A template set by a previous call is replaced.
+		 */
+		self_type_t &
+		use_header_template( header_template_t tmpl ) & noexcept
+		{
+			m_header_template = std::move( tmpl );
+			return *this;
+		}
+
+		//! Use pre-serialized header fields.
+		self_type_t &&
+		use_header_template( header_template_t tmpl ) && noexcept
+		{
+			return std::move( this->use_header_template( std::move( tmpl ) ) );
+		}
+
+		//! Set connection close.
+		self_type_t &
+		connection_close() & noexcept
+		{
+			m_should_keep_alive = false;
+			return *this;
+		}
+
+		//! Set connection close.
+		self_type_t &&
+		connection_close() && noexcept
+		{
+			return std::move( this->connection_close() );
+		}
+
+		//! Set connection keep-alive.
+		self_type_t &
+		connection_keep_alive() & noexcept
+		{
+			m_should_keep_alive = true;
+			return *this;
+		}
+
+		//! Set connection keep-alive.
+		self_type_t &&
+		connection_keep_alive() && noexcept
+		{
+			return std::move( this->connection_keep_alive() );
+		}
+
+		//! Set body.
+		self_type_t &
+		set_body( writable_item_t body ) &
+		{
+			m_body_parts.clear();
+			m_body_size = 0u;
+			return append_body( std::move( body ) );
+		}
+
+		//! Set body.
+		self_type_t &&
+		set_body( writable_item_t body ) &&
+		{
+			return std::move( this->set_body( std::move( body ) ) );
+		}
+
+		//! Append body.
+		self_type_t &
+		append_body( writable_item_t body_part ) &
+		{
+			const auto size = body_part.size();
+			if( 0u < size )
+			{
+				m_body_parts.emplace_back( std::move( body_part ) );
+				m_body_size += size;
+			}
+
+			return *this;
+		}
+
+		//! Append body.
+		self_type_t &&
+		append_body( writable_item_t body_part ) &&
+		{
+			return std::move( this->append_body( std::move( body_part ) ) );
+		}
+
+		//! Complete response.
+		request_handling_status_t
+		done( write_status_cb_t wscb = write_status_cb_t{} )
+		{
+			if( !m_connection )
+				throw exception_t{ "done() cannot be called twice" };
+
+			auto & buf = m_header.str();
+
+			if( m_auto_date_field && !m_has_date_field )
+				append_field(
+						field_to_string( http_field_t::date ),
+						impl::cached_date_field_value() );
+
+			impl::append_connection_field(
+					buf,
+					m_should_keep_alive ?
+						http_connection_header_t::keep_alive :
+						http_connection_header_t::close );
+			impl::append_content_length_field( buf, m_body_size );
+
+			writable_items_container_t parts;
+			parts.reserve( 2u + m_body_parts.size() );
+			if( !m_header_template )
+			{
+				constexpr const char header_rn[] = "\r\n";
+				buf.append( header_rn, impl::ct_string_len( header_rn ) );
+				parts.emplace_back( std::move( m_header ) );
+			}
+			else
+			{
+				parts.emplace_back( std::move( m_header ) );
+				parts.emplace_back( m_header_template.make_writable_item() );
+			}
+
+			for( auto & part : m_body_parts )
+				parts.emplace_back( std::move( part ) );
+
+			write_group_t wg{ std::move( parts ) };
+			wg.status_line_size( m_status_line_size );
+
+			if( wscb )
+			{
+				wg.after_write_notificator( std::move( wscb ) );
+			}
+
+			const response_output_flags_t
+				response_output_flags{
+					response_parts_attr_t::final_parts,
+					response_connection_attr( m_should_keep_alive ) };
+
+			auto conn = std::move( m_connection );
+
+			conn->write_response_parts(
+				m_request_id,
+				response_output_flags,
+				std::move( wg ) );
+
+			return restinio::request_accepted();
+		}
+
+	private:
+		void
+		append_field( string_view_t name, string_view_t value )
+		{
+			auto & buf = m_header.str();
+			buf.append( name.data(), name.size() );
+			buf.append( ": ", 2u );
+			buf.append( value.data(), value.size() );
+			buf.append( "\r\n", 2u );
+		}
+
+		impl::connection_handle_t m_connection;
+		request_id_t m_request_id;
+
+		bool m_should_keep_alive;
+		const bool m_auto_date_field;
+		bool m_has_date_field{ false };
+
+		//! Serialized status line and header fields.
+		impl::pooled_string_buffer_t m_header;
+
+		//! Size of the status line (without "\r\n").
+		std::size_t m_status_line_size;
+
+		header_template_t m_header_template;
+
+		std::size_t m_body_size{ 0u };
+		writable_items_container_t m_body_parts;
+};
+
 //! Tag type for user controlled output response builder.
 struct user_controlled_output_t {};
 
@@ -501,6 +978,62 @@ class response_builder_t< user_controlled_output_t > final
 			return std::move( this->flush( std::move( wscb ) ) );
 		}
 
+		//! Is there room for more outgoing data in the connection?
+		/*!
+		 * Returns false if the amount of data queued by the connection
+		 * reached the high watermark (see
+		 * server_settings_t::outgoing_data_watermarks()). In that case
+		 * the producer should wait for a call of the callback passed to
+		 * when_output_writable().
+		 *
+		 * Returns false if the response is already completed.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		output_is_writable() const noexcept
+		{
+			return m_connection && m_connection->output_is_writable();
+		}
+
+		//! Call @a cb when the producer may continue.
+		/*!
+		 * The callback is called with an empty error code when the amount
+		 * of data queued by the connection falls to the low watermark (or
+		 * right away if it's already so). If the connection is closed
+		 * the callback is called with an error.
+		 *
+		 * For connections created by RESTinio's server the callback is
+		 * always called on the connection's executor, never from this
+		 * method. A custom connection type that doesn't override
+		 * impl::connection_base_t::when_output_writable() calls it
+		 * right from this method.
+		 *
+		 * See response_builder_t<chunked_output_t>::when_output_writable()
+		 * for a usage example.
+		 *
+		 * @throw exception_t if the response is already completed.
+		 *
+		 * @since v.0.7.10
+		 */
+		self_type_t &
+		when_output_writable( write_status_cb_t cb ) &
+		{
+			if( !m_connection )
+				throw exception_t{ "response is already completed" };
+
+			m_connection->when_output_writable( std::move( cb ) );
+			return *this;
+		}
+
+		//! Call @a cb when the producer may continue.
+		self_type_t &&
+		when_output_writable( write_status_cb_t cb ) &&
+		{
+			return std::move( this->when_output_writable( std::move( cb ) ) );
+		}
+
 		//! Complete response.
 		request_handling_status_t
 		done( write_status_cb_t wscb = write_status_cb_t{} )
@@ -540,8 +1073,9 @@ class response_builder_t< user_controlled_output_t > final
 
 				if_neccessary_reserve_first_element_for_header();
 
-				m_response_parts[ 0 ] =
-					writable_item_t{ impl::create_header_string( m_header ) };
+				put_header_items(
+						m_response_parts,
+						impl::content_length_field_presence_t::add_content_length );
 
 				m_header_was_sent = true;
 				status_line_size = calculate_status_line_size();
@@ -710,6 +1244,76 @@ class response_builder_t< chunked_output_t > final
 			return std::move( this->flush( std::move( wscb ) ) );
 		}
 
+		//! Is there room for more outgoing data in the connection?
+		/*!
+		 * Returns false if the amount of data queued by the connection
+		 * reached the high watermark (see
+		 * server_settings_t::outgoing_data_watermarks()). In that case
+		 * the producer should wait for a call of the callback passed to
+		 * when_output_writable().
+		 *
+		 * Returns false if the response is already completed.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		output_is_writable() const noexcept
+		{
+			return m_connection && m_connection->output_is_writable();
+		}
+
+		//! Call @a cb when the producer may continue.
+		/*!
+		 * The callback is called with an empty error code when the amount
+		 * of data queued by the connection falls to the low watermark (or
+		 * right away if it's already so). If the connection is closed
+		 * the callback is called with an error.
+		 *
+		 * For connections created by RESTinio's server the callback is
+		 * always called on the connection's executor, never from this
+		 * method. A custom connection type that doesn't override
+		 * impl::connection_base_t::when_output_writable() calls it
+		 * right from this method.
+		 *
+		 * Usage example:
+		 * @code
+		 * void produce( std::shared_ptr< chunked_response_t > resp )
+		 * {
+		 * 	while( resp->output_is_writable() && has_more_data() )
+		 * 		resp->append_chunk( next_piece() ).flush();
+		 *
+		 * 	if( !has_more_data() )
+		 * 		resp->done();
+		 * 	else
+		 * 		resp->when_output_writable(
+		 * 			[resp]( const auto & ec ) {
+		 * 				if( !ec ) produce( resp );
+		 * 			} );
+		 * }
+		 * @endcode
+		 *
+		 * @throw exception_t if the response is already completed.
+		 *
+		 * @since v.0.7.10
+		 */
+		self_type_t &
+		when_output_writable( write_status_cb_t cb ) &
+		{
+			if( !m_connection )
+				throw exception_t{ "response is already completed" };
+
+			m_connection->when_output_writable( std::move( cb ) );
+			return *this;
+		}
+
+		//! Call @a cb when the producer may continue.
+		self_type_t &&
+		when_output_writable( write_status_cb_t cb ) &&
+		{
+			return std::move( this->when_output_writable( std::move( cb ) ) );
+		}
+
 		//! Complete response.
 		request_handling_status_t
 		done( write_status_cb_t wscb = write_status_cb_t{} )
@@ -812,6 +1416,8 @@ class response_builder_t< chunked_output_t > final
 			if( !m_header_was_sent )
 			{
 				++reserve_size;
+				if( m_header_template )
+					++reserve_size;
 			}
 			if( add_zero_chunk )
 			{
@@ -822,10 +1428,10 @@ class response_builder_t< chunked_output_t > final
 
 			if( !m_header_was_sent )
 			{
-				bufs.emplace_back(
-					impl::create_header_string(
-						m_header,
-						impl::content_length_field_presence_t::skip_content_length ) );
+				bufs.emplace_back();
+				put_header_items(
+						bufs,
+						impl::content_length_field_presence_t::skip_content_length );
 			}
 
 			// Since fmtlib-8.0.0 compile-time checks of format strings
@@ -848,7 +1454,7 @@ class response_builder_t< chunked_output_t > final
 				bufs.emplace_back(
 					fmt::format(
 						RESTINIO_FMT_FORMAT_STRING( "{:X}\r\n" ),
-						asio_ns::buffer_size( chunk_it->buf() ) ) );
+						chunk_it->size() ) );
 				bufs.emplace_back( std::move( *chunk_it ) );
 
 				for( ++chunk_it; chunk_it != chunk_end; ++chunk_it )
@@ -856,7 +1462,7 @@ class response_builder_t< chunked_output_t > final
 					bufs.emplace_back(
 						fmt::format(
 							RESTINIO_FMT_FORMAT_STRING( "\r\n{:X}\r\n" ),
-							asio_ns::buffer_size( chunk_it->buf() ) ) );
+							chunk_it->size() ) );
 					bufs.emplace_back( std::move( *chunk_it ) );
 				}
 			}
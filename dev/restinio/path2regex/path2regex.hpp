@@ -362,6 +362,33 @@ enum class token_type_t : std::uint8_t
 	capturing_token
 };
 
+//
+// token_description_t
+//
+
+//! Description of a token for matchers that don't use regex.
+/*!
+ * @since v.0.7.10
+ */
+struct token_description_t
+{
+	token_type_t m_type{ token_type_t::plain_string };
+
+	//! Unescaped text of a plain string or a prefix of a parameter.
+	std::string m_text;
+
+	//! Params of a parameter.
+	//! \{
+	std::string m_delimiter;
+	bool m_optional{ false };
+	bool m_repeat{ false };
+	bool m_partial{ false };
+
+	//! Is the default pattern (a sequence of non-delimiter chars) used?
+	bool m_default_pattern{ false };
+	//! \}
+};
+
 //
 // token_t
 //
@@ -387,6 +414,13 @@ class token_t
 		{
 			return false;
 		}
+
+		//! Get a description of the token.
+		/*!
+		 * @since v.0.7.10
+		 */
+		virtual token_description_t
+		describe() const = 0;
 };
 
 template < typename Route_Param_Appender >
@@ -405,7 +439,8 @@ class plain_string_token_t final : public token_t< Route_Param_Appender >
 {
 	public:
 		plain_string_token_t( const std::string & path )
-			:	m_escaped_path{ escape_string( path ) }
+			:	m_path{ path }
+			,	m_escaped_path{ escape_string( path ) }
 			,	m_last_char{ path.back() }
 		{}
 
@@ -426,7 +461,23 @@ class plain_string_token_t final : public token_t< Route_Param_Appender >
 			return std::string::npos != delimiters.find( m_last_char );
 		}
 
+		virtual token_description_t
+		describe() const override
+		{
+			token_description_t result;
+			result.m_type = token_type_t::plain_string;
+			result.m_text = m_path;
+
+			return result;
+		}
+
 	private:
+		//! Original piece of the route.
+		/*!
+		 * @since v.0.7.10
+		 */
+		const std::string m_path;
+
 		//! Already escaped piece of the route.
 		const std::string m_escaped_path;
 		const char m_last_char;
@@ -461,6 +512,7 @@ class parameter_token_t final : public token_t< Route_Param_Appender >
 			bool partial,
 			std::string pattern )
 			:	m_name{ std::move( name ) }
+			,	m_prefix{ prefix }
 			,	m_escaped_prefix{ escape_string( prefix ) }
 			,	m_delimiter{ std::move( delimiter ) }
 			,	m_optional{ optional }
@@ -511,8 +563,29 @@ class parameter_token_t final : public token_t< Route_Param_Appender >
 			return token_type_t::capturing_token;
 		}
 
+		virtual token_description_t
+		describe() const override
+		{
+			token_description_t result;
+			result.m_type = token_type_t::capturing_token;
+			result.m_text = m_prefix;
+			result.m_delimiter = m_delimiter;
+			result.m_optional = m_optional;
+			result.m_repeat = m_repeat;
+			result.m_partial = m_partial;
+			result.m_default_pattern =
+				m_pattern == "[^" + escape_string( m_delimiter ) + "]+?";
+
+			return result;
+		}
+
 	private:
 		const Name m_name;
+		//! Original prefix.
+		/*!
+		 * @since v.0.7.10
+		 */
+		const std::string m_prefix;
 		const std::string m_escaped_prefix;
 		const std::string m_delimiter;
 		const bool m_optional;
@@ -0,0 +1,340 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Allocators for request objects.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/utils/metaprogramming.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+
+namespace restinio
+{
+
+//
+// std_request_allocator_t
+//
+/*!
+ * @brief The default request allocator.
+ *
+ * Request objects are created by std::allocate_shared with
+ * std::allocator, that is the same as std::make_shared.
+ *
+ * A request allocator is created for every connection and is used
+ * for the creation of all request objects for that connection.
+ * It has to provide the following method:
+ * @code
+ * template< typename T >
+ * SomeAllocator<T> make_allocator();
+ * @endcode
+ * The returned allocator is passed to std::allocate_shared.
+ *
+ * @since v.0.7.10
+ */
+class std_request_allocator_t
+{
+	public:
+		template< typename T >
+		[[nodiscard]]
+		std::allocator< T >
+		make_allocator() const noexcept { return {}; }
+};
+
+namespace impl
+{
+
+//
+// request_arena_t
+//
+/*!
+ * @brief A monotonic arena for request objects of a connection.
+ *
+ * Memory is taken from the fixed-size buffer by incrementing the
+ * current position. The buffer is rewound when all objects allocated
+ * from the arena are deallocated (usually it is when responses for all
+ * received requests are completed and request objects are released).
+ * If there is no free space in the buffer then the ordinary `operator new`
+ * is used.
+ *
+ * @note
+ * Allocations are performed only on the context of the connection,
+ * but deallocation can be performed on any thread (a request object can
+ * be released on a thread where it was handled). Because of that the
+ * counter of live objects is atomic and rewinding of the buffer is
+ * performed only by allocation.
+ *
+ * @since v.0.7.10
+ */
+class request_arena_t
+{
+	public:
+		request_arena_t( const request_arena_t & ) = delete;
+		request_arena_t & operator=( const request_arena_t & ) = delete;
+
+		explicit request_arena_t( std::size_t capacity )
+			:	m_buffer{ new std::max_align_t[
+					(capacity + sizeof(std::max_align_t) - 1u) /
+							sizeof(std::max_align_t) ] }
+			,	m_capacity{ capacity }
+		{}
+
+		[[nodiscard]]
+		void *
+		allocate( std::size_t size, std::size_t alignment )
+		{
+			// If there are no live objects the whole buffer can be reused.
+			if( 0u == m_live_objects.load( std::memory_order_acquire ) )
+				m_position = 0u;
+
+			auto * const begin = reinterpret_cast< char * >( m_buffer.get() );
+			const auto current = reinterpret_cast< std::uintptr_t >(
+					begin + m_position );
+			const auto aligned = (current + alignment - 1u) &
+					~(static_cast< std::uintptr_t >( alignment ) - 1u);
+			const std::size_t offset = static_cast< std::size_t >(
+					aligned - reinterpret_cast< std::uintptr_t >( begin ) );
+
+			if( offset + size <= m_capacity )
+			{
+				m_position = offset + size;
+				m_live_objects.fetch_add( 1u, std::memory_order_relaxed );
+				++m_arena_allocations;
+
+				return begin + offset;
+			}
+
+			++m_heap_allocations;
+			return ::operator new( size );
+		}
+
+		void
+		deallocate( void * p ) noexcept
+		{
+			if( owns( p ) )
+				m_live_objects.fetch_sub( 1u, std::memory_order_release );
+			else
+				::operator delete( p );
+		}
+
+		//! How many allocations were performed inside the arena.
+		[[nodiscard]]
+		std::uint64_t
+		arena_allocations() const noexcept { return m_arena_allocations; }
+
+		//! How many allocations were delegated to `operator new`.
+		[[nodiscard]]
+		std::uint64_t
+		heap_allocations() const noexcept { return m_heap_allocations; }
+
+	private:
+		std::unique_ptr< std::max_align_t[] > m_buffer;
+		const std::size_t m_capacity;
+
+		//! The current position in the buffer.
+		/*!
+		 * @note
+		 * Is modified only by allocate() method.
+		 */
+		std::size_t m_position{ 0u };
+
+		//! Count of live objects inside the buffer.
+		std::atomic< std::size_t > m_live_objects{ 0u };
+
+		//! Statistics.
+		//! \{
+		std::uint64_t m_arena_allocations{ 0u };
+		std::uint64_t m_heap_allocations{ 0u };
+		//! \}
+
+		[[nodiscard]]
+		bool
+		owns( const void * p ) const noexcept
+		{
+			const auto * const begin =
+					reinterpret_cast< const char * >( m_buffer.get() );
+			const auto * const ptr = static_cast< const char * >( p );
+
+			return std::less_equal<>{}( begin, ptr ) &&
+					std::less<>{}( ptr, begin + m_capacity );
+		}
+};
+
+//
+// request_arena_allocator_t
+//
+/*!
+ * @brief An allocator that takes memory from request_arena_t.
+ *
+ * Holds a shared pointer to the arena, so the arena lives while there
+ * is at least one object allocated from it (even if the connection
+ * is already destroyed).
+ *
+ * @since v.0.7.10
+ */
+template< typename T >
+class request_arena_allocator_t
+{
+	template< typename U >
+	friend class request_arena_allocator_t;
+
+	std::shared_ptr< request_arena_t > m_arena;
+
+	public:
+		using value_type = T;
+
+		explicit request_arena_allocator_t(
+			std::shared_ptr< request_arena_t > arena ) noexcept
+			:	m_arena{ std::move( arena ) }
+		{}
+
+		template< typename U >
+		request_arena_allocator_t(
+			const request_arena_allocator_t< U > & other ) noexcept
+			:	m_arena{ other.m_arena }
+		{}
+
+		[[nodiscard]]
+		T *
+		allocate( std::size_t n )
+		{
+			static_assert( alignof(T) <= alignof(std::max_align_t),
+					"over-aligned types are not supported" );
+
+			return static_cast< T * >(
+					m_arena->allocate( n * sizeof(T), alignof(T) ) );
+		}
+
+		void
+		deallocate( T * p, std::size_t ) noexcept
+		{
+			m_arena->deallocate( p );
+		}
+
+		template< typename U >
+		bool
+		operator==( const request_arena_allocator_t< U > & o ) const noexcept
+		{
+			return m_arena == o.m_arena;
+		}
+
+		template< typename U >
+		bool
+		operator!=( const request_arena_allocator_t< U > & o ) const noexcept
+		{
+			return m_arena != o.m_arena;
+		}
+};
+
+} /* namespace impl */
+
+//
+// arena_request_allocator_t
+//
+/*!
+ * @brief A request allocator that creates request objects inside
+ * a per-connection monotonic arena.
+ *
+ * The arena is a buffer of @a Arena_Size bytes. Request objects
+ * (together with shared_ptr's control blocks) are placed into this
+ * buffer one after another. The buffer is rewound when all request
+ * objects of the connection are released (it usually happens when
+ * the response is completed). If there is no space in the buffer (for
+ * example, because of pipelined requests or because a request object is
+ * held by the user for a long time) then the ordinary `operator new`
+ * is used.
+ *
+ * @attention
+ * Only the request object itself is placed into the arena, so this
+ * allocator saves one heap allocation per request. The data of the
+ * request (the target, names and values of header fields, the body)
+ * is held in std::string members of the request and still uses
+ * the global allocator.
+ *
+ * Usage example:
+ * @code
+ * struct my_traits : public restinio::default_traits_t {
+ * 	using request_allocator_t = restinio::arena_request_allocator_t<>;
+ * };
+ * @endcode
+ *
+ * @since v.0.7.10
+ */
+template< std::size_t Arena_Size = 2048u >
+class arena_request_allocator_t
+{
+	static_assert( 0u != Arena_Size, "Arena_Size can't be 0" );
+
+	std::shared_ptr< impl::request_arena_t > m_arena;
+
+	public:
+		arena_request_allocator_t()
+			:	m_arena{ std::make_shared< impl::request_arena_t >( Arena_Size ) }
+		{}
+
+		template< typename T >
+		[[nodiscard]]
+		impl::request_arena_allocator_t< T >
+		make_allocator() const noexcept
+		{
+			return impl::request_arena_allocator_t< T >{ m_arena };
+		}
+
+		//! Get access to the underlying arena.
+		/*!
+		 * @note
+		 * It's intended to be used for testing and statistics.
+		 */
+		[[nodiscard]]
+		const impl::request_arena_t &
+		arena() const noexcept { return *m_arena; }
+};
+
+namespace details
+{
+
+template< typename, typename = restinio::utils::metaprogramming::void_t<> >
+struct request_allocator_type_detector
+{
+	using type = std_request_allocator_t;
+};
+
+template< typename Traits >
+struct request_allocator_type_detector<
+		Traits,
+		restinio::utils::metaprogramming::void_t<
+				typename Traits::request_allocator_t > >
+{
+	using type = typename Traits::request_allocator_t;
+};
+
+} /* namespace details */
+
+//
+// request_allocator_type_from_traits_t
+//
+/*!
+ * @brief A metafunction for the detection of request allocator type
+ * from server's traits.
+ *
+ * If Traits doesn't define `request_allocator_t` then
+ * std_request_allocator_t is used.
+ *
+ * @since v.0.7.10
+ */
+template< typename Traits >
+using request_allocator_type_from_traits_t =
+	typename details::request_allocator_type_detector< Traits >::type;
+
+} /* namespace restinio */
@@ -14,6 +14,7 @@
 #include <restinio/http_headers.hpp>
 #include <restinio/message_builders.hpp>
 #include <restinio/chunked_input_info.hpp>
+#include <restinio/body_rope.hpp>
 #include <restinio/impl/connection_base.hpp>
 
 #include <array>
@@ -260,6 +261,34 @@ class generic_request_t final
 			,	m_extra_data_holder{ extra_data_factory }
 		{}
 
+		//! Initializing constructor for the case of a body in the form
+		//! of a rope.
+		/*!
+		 * @since v.0.7.10
+		 */
+		template< typename Extra_Data_Factory >
+		generic_request_t(
+			request_id_t request_id,
+			http_request_header_t header,
+			std::string body,
+			body_rope_t body_rope,
+			chunked_input_info_unique_ptr_t chunked_input_info,
+			impl::connection_handle_t connection,
+			endpoint_t remote_endpoint,
+			Extra_Data_Factory & extra_data_factory )
+			:	generic_request_t{
+					request_id,
+					std::move( header ),
+					std::move( body ),
+					std::move( chunked_input_info ),
+					std::move( connection ),
+					std::move( remote_endpoint ),
+					extra_data_factory
+				}
+		{
+			m_body_rope = std::move( body_rope );
+		}
+
 		//! Get request header.
 		const http_request_header_t &
 		header() const noexcept
@@ -274,6 +303,20 @@ class generic_request_t final
 			return m_body;
 		}
 
+		//! Get request body stored as a rope.
+		/*!
+		 * The rope is empty if server_settings_t::request_body_as_rope()
+		 * isn't turned on.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		const body_rope_t &
+		body_rope() const noexcept
+		{
+			return m_body_rope;
+		}
+
 		template < typename Output = restinio_controlled_output_t >
 		auto
 		create_response( http_status_line_t status_line = status_ok() )
@@ -412,6 +455,11 @@ class generic_request_t final
 		const http_request_header_t m_header;
 		const std::string m_body;
 
+		/*!
+		 * @since v.0.7.10
+		 */
+		body_rope_t m_body_rope;
+
 		//! Optional description for chunked-encoding.
 		/*!
 		 * It is present only if chunked-encoded body is found in the
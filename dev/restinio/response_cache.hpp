@@ -0,0 +1,487 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Cache of serialized responses.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/http_headers.hpp>
+#include <restinio/buffers.hpp>
+#include <restinio/common_types.hpp>
+#include <restinio/string_view.hpp>
+#include <restinio/impl/header_helpers.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace restinio
+{
+
+//
+// cached_response_t
+//
+/*!
+ * @brief An immutable serialized response.
+ *
+ * The response is serialized once when it is put into the cache and
+ * then it is shared by all write groups created for cache hits.
+ *
+ * @since v.0.7.10
+ */
+class cached_response_t
+{
+	public:
+		cached_response_t(
+			const http_status_line_t & status_line,
+			const http_header_fields_t & fields,
+			std::string body )
+		{
+			std::string head;
+			impl::append_status_line(
+					head,
+					1u,
+					1u,
+					status_line.status_code(),
+					status_line.reason_phrase() );
+			m_status_line_size = head.size() - 2u;
+
+			for( const auto & f : fields )
+			{
+				head.append( f.name() );
+				head.append( ": " );
+				head.append( f.value() );
+				head.append( "\r\n" );
+			}
+			impl::append_content_length_field( head, body.size() );
+
+			m_head = std::make_shared< const std::string >( std::move( head ) );
+			if( !body.empty() )
+				m_body = std::make_shared< const std::string >( std::move( body ) );
+		}
+
+		//! Total size of serialized data.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept
+		{
+			return m_head->size() + ( m_body ? m_body->size() : 0u );
+		}
+
+		//! Make a write group for writing the response.
+		/*!
+		 * Only `Connection` field isn't serialized in advance because it
+		 * depends on a request.
+		 */
+		[[nodiscard]]
+		write_group_t
+		make_write_group( response_connection_attr_t connection_attr ) const
+		{
+			static constexpr string_view_t keep_alive_ending{
+					"Connection: keep-alive\r\n\r\n" };
+			static constexpr string_view_t close_ending{
+					"Connection: close\r\n\r\n" };
+
+			const auto & ending =
+				response_connection_attr_t::connection_keepalive == connection_attr ?
+					keep_alive_ending : close_ending;
+
+			writable_items_container_t items;
+			items.emplace_back( m_head );
+			items.emplace_back( const_buffer( ending.data(), ending.size() ) );
+			if( m_body )
+				items.emplace_back( m_body );
+
+			write_group_t wg{ std::move( items ) };
+			wg.status_line_size( m_status_line_size );
+
+			return wg;
+		}
+
+	private:
+		//! Status line and header fields (without `Connection` field).
+		std::shared_ptr< const std::string > m_head;
+
+		//! Body (it's nullptr for an empty body).
+		std::shared_ptr< const std::string > m_body;
+
+		//! Size of the status line (without "\r\n").
+		std::size_t m_status_line_size;
+};
+
+//
+// response_cache_t
+//
+/*!
+ * @brief A thread safe cache of serialized responses.
+ *
+ * Responses are keyed by the method, the request target and the
+ * values of selected request header fields (e.g. `Accept-Encoding`).
+ * Only responses for GET and HEAD requests are cached.
+ *
+ * If a server has a response cache (see
+ * server_settings_t::response_cache()) then a connection looks for
+ * a response in the cache before calling the request handler. If the
+ * response is found it's written without calling the handler.
+ *
+ * Responses are put into the cache by the application:
+ * @code
+ * auto cache = std::make_shared< restinio::response_cache_t >(
+ * 		16u * 1024u * 1024u,
+ * 		std::vector< std::string >{ "Accept-Encoding" } );
+ * ...
+ * server_settings.response_cache( cache );
+ * ...
+ * // In a request handler:
+ * restinio::http_header_fields_t fields;
+ * fields.add_field( restinio::http_field::content_type, "application/json" );
+ * cache->store( req->header(), restinio::status_ok(), fields, body,
+ * 		std::chrono::seconds{ 10 } );
+ * @endcode
+ *
+ * The total size of cached responses is bounded. If there is no room
+ * for a new response then old responses are removed by the CLOCK
+ * algorithm (an approximation of LRU): a response that was found since
+ * the previous check gets a second chance.
+ *
+ * A lookup doesn't allocate memory and acquires a shared lock, so
+ * lookups from different threads don't block each other. Requests with
+ * methods other than GET and HEAD are rejected without any lock.
+ *
+ * @note
+ * The request handler isn't called for cache hits, so it's up to
+ * the application to store only responses that don't depend on anything
+ * except the key of the cache.
+ *
+ * @since v.0.7.10
+ */
+class response_cache_t
+{
+	public:
+		response_cache_t(
+			//! Max total size of cached responses.
+			std::size_t max_total_size,
+			//! Names of request fields that are parts of the key.
+			std::vector< std::string > key_fields = {} )
+			:	m_max_total_size{ max_total_size }
+			,	m_key_fields{ std::move( key_fields ) }
+		{}
+
+		response_cache_t( const response_cache_t & ) = delete;
+		response_cache_t & operator=( const response_cache_t & ) = delete;
+
+		//! Store a response for requests like @a request.
+		/*!
+		 * A previous response for the same key is replaced.
+		 *
+		 * @return false if the response is too big for the cache or if
+		 * the method of @a request is neither GET nor HEAD.
+		 */
+		bool
+		store(
+			const http_request_header_t & request,
+			const http_status_line_t & status_line,
+			const http_header_fields_t & fields,
+			std::string body,
+			std::chrono::steady_clock::duration ttl )
+		{
+			if( !is_cacheable( request.method() ) )
+				return false;
+
+			auto response = std::make_shared< const cached_response_t >(
+					status_line, fields, std::move( body ) );
+			if( response->size() > m_max_total_size )
+				return false;
+
+			const auto target = request.request_target();
+			const auto hash = make_hash( request.method(), target );
+			auto key_field_values = make_key_field_values( request );
+			const auto expires_at = std::chrono::steady_clock::now() + ttl;
+
+			std::unique_lock< std::shared_mutex > lock{ m_lock };
+
+			if( auto it = find_entry( hash, request.method(), target, request );
+					it != m_entries.end() )
+				erase_entry( it );
+
+			while( m_total_size + response->size() > m_max_total_size )
+				evict_one();
+
+			m_total_size += response->size();
+			m_entries.emplace_back(
+					hash,
+					request.method(),
+					std::string{ target.data(), target.size() },
+					std::move( key_field_values ),
+					std::move( response ),
+					expires_at );
+			m_index[ hash ].push_back( std::prev( m_entries.end() ) );
+
+			return true;
+		}
+
+		//! Find a response for a request.
+		/*!
+		 * @return nullptr if there is no actual response for the request.
+		 */
+		[[nodiscard]]
+		std::shared_ptr< const cached_response_t >
+		find( const http_request_header_t & request )
+		{
+			if( !is_cacheable( request.method() ) )
+				return {};
+
+			const auto target = request.request_target();
+			const auto hash = make_hash( request.method(), target );
+
+			{
+				std::shared_lock< std::shared_mutex > lock{ m_lock };
+
+				const auto it = find_entry( hash, request.method(), target, request );
+				if( it == m_entries.end() )
+					return {};
+
+				if( std::chrono::steady_clock::now() < it->m_expires_at )
+				{
+					it->m_referenced.store( true, std::memory_order_relaxed );
+					return it->m_response;
+				}
+			}
+
+			// The response is expired and has to be removed.
+			// It's a rare case, so the entry is searched once more.
+			std::unique_lock< std::shared_mutex > lock{ m_lock };
+
+			const auto it = find_entry( hash, request.method(), target, request );
+			if( it != m_entries.end() &&
+					it->m_expires_at <= std::chrono::steady_clock::now() )
+				erase_entry( it );
+
+			return {};
+		}
+
+		//! Remove all responses for a method and a request target.
+		void
+		invalidate( http_method_id_t method, string_view_t request_target )
+		{
+			const auto hash = make_hash( method, request_target );
+
+			std::unique_lock< std::shared_mutex > lock{ m_lock };
+
+			const auto index_it = m_index.find( hash );
+			if( index_it != m_index.end() )
+			{
+				const auto entries = index_it->second;
+				for( auto it : entries )
+					if( it->m_method == method &&
+							it->m_request_target == request_target )
+						erase_entry( it );
+			}
+		}
+
+		//! Remove all responses.
+		void
+		clear()
+		{
+			std::unique_lock< std::shared_mutex > lock{ m_lock };
+
+			m_index.clear();
+			m_entries.clear();
+			m_total_size = 0u;
+		}
+
+		//! Total size of cached responses.
+		[[nodiscard]]
+		std::size_t
+		total_size() const
+		{
+			std::shared_lock< std::shared_mutex > lock{ m_lock };
+			return m_total_size;
+		}
+
+	private:
+		//! Values of key fields (nullopt for a missing field).
+		using key_field_values_t = std::vector< std::optional< std::string > >;
+
+		struct entry_t
+		{
+			entry_t(
+				std::size_t hash,
+				http_method_id_t method,
+				std::string request_target,
+				key_field_values_t key_field_values,
+				std::shared_ptr< const cached_response_t > response,
+				std::chrono::steady_clock::time_point expires_at )
+				:	m_hash{ hash }
+				,	m_method{ method }
+				,	m_request_target{ std::move( request_target ) }
+				,	m_key_field_values{ std::move( key_field_values ) }
+				,	m_response{ std::move( response ) }
+				,	m_expires_at{ expires_at }
+			{}
+
+			const std::size_t m_hash;
+			const http_method_id_t m_method;
+			const std::string m_request_target;
+			const key_field_values_t m_key_field_values;
+			const std::shared_ptr< const cached_response_t > m_response;
+			const std::chrono::steady_clock::time_point m_expires_at;
+
+			//! Was the entry found since the previous check by evict_one()?
+			/*!
+			 * It's modified under a shared lock.
+			 */
+			std::atomic< bool > m_referenced{ false };
+		};
+
+		//! Entries in the order of the CLOCK algorithm.
+		/*!
+		 * The first entry is the next candidate for the eviction.
+		 */
+		using entries_container_t = std::list< entry_t >;
+
+		[[nodiscard]]
+		static bool
+		is_cacheable( http_method_id_t method ) noexcept
+		{
+			return http_method_get() == method || http_method_head() == method;
+		}
+
+		//! Hash of a method and a request target.
+		/*!
+		 * It's calculated without memory allocations.
+		 */
+		[[nodiscard]]
+		static std::size_t
+		make_hash( http_method_id_t method, string_view_t request_target ) noexcept
+		{
+			const auto h = std::hash< string_view_t >{}( request_target );
+			return h ^ ( static_cast< std::size_t >( method.raw_id() ) +
+					0x9e3779b9u + ( h << 6 ) + ( h >> 2 ) );
+		}
+
+		[[nodiscard]]
+		key_field_values_t
+		make_key_field_values( const http_request_header_t & request ) const
+		{
+			key_field_values_t result;
+			result.reserve( m_key_fields.size() );
+			for( const auto & name : m_key_fields )
+			{
+				// A missing field and an empty field are different keys.
+				if( const auto * value = request.try_get_field( name ) )
+					result.emplace_back( *value );
+				else
+					result.emplace_back( std::nullopt );
+			}
+			return result;
+		}
+
+		//! Do values of key fields of @a request match the entry?
+		[[nodiscard]]
+		bool
+		key_fields_match(
+			const entry_t & entry,
+			const http_request_header_t & request ) const noexcept
+		{
+			for( std::size_t i = 0u; i != m_key_fields.size(); ++i )
+			{
+				const auto * value = request.try_get_field( m_key_fields[ i ] );
+				const auto & expected = entry.m_key_field_values[ i ];
+				if( static_cast< bool >( value ) != expected.has_value() ||
+						( value && *value != *expected ) )
+					return false;
+			}
+
+			return true;
+		}
+
+		//! Find an entry for a request.
+		/*!
+		 * @note
+		 * Must be called under the lock (shared or exclusive).
+		 */
+		[[nodiscard]]
+		entries_container_t::iterator
+		find_entry(
+			std::size_t hash,
+			http_method_id_t method,
+			string_view_t request_target,
+			const http_request_header_t & request )
+		{
+			const auto index_it = m_index.find( hash );
+			if( index_it != m_index.end() )
+				for( auto it : index_it->second )
+					if( it->m_method == method &&
+							it->m_request_target == request_target &&
+							key_fields_match( *it, request ) )
+						return it;
+
+			return m_entries.end();
+		}
+
+		//! Remove an entry by the CLOCK algorithm.
+		/*!
+		 * @note
+		 * Must be called under the exclusive lock.
+		 */
+		void
+		evict_one()
+		{
+			for(;;)
+			{
+				const auto it = m_entries.begin();
+				if( !it->m_referenced.exchange( false, std::memory_order_relaxed ) )
+				{
+					erase_entry( it );
+					return;
+				}
+
+				// The entry gets a second chance.
+				m_entries.splice( m_entries.end(), m_entries, it );
+			}
+		}
+
+		void
+		erase_entry( entries_container_t::iterator it )
+		{
+			const auto index_it = m_index.find( it->m_hash );
+			auto & variants = index_it->second;
+			variants.erase( std::find( variants.begin(), variants.end(), it ) );
+			if( variants.empty() )
+				m_index.erase( index_it );
+
+			m_total_size -= it->m_response->size();
+			m_entries.erase( it );
+		}
+
+		mutable std::shared_mutex m_lock;
+
+		const std::size_t m_max_total_size;
+		const std::vector< std::string > m_key_fields;
+
+		std::size_t m_total_size{ 0u };
+		entries_container_t m_entries;
+
+		//! Entries with the same hash of a method and a request target.
+		std::unordered_map<
+				std::size_t,
+				std::vector< entries_container_t::iterator > > m_index;
+};
+
+} /* namespace restinio */
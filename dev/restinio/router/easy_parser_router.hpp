@@ -12,6 +12,7 @@
 #pragma once
 
 #include <restinio/router/impl/target_path_holder.hpp>
+#include <restinio/router/impl/method_dispatch_table.hpp>
 #include <restinio/router/non_matched_request_handler.hpp>
 #include <restinio/router/method_matcher.hpp>
 
@@ -72,6 +73,27 @@ public:
 	try_handle(
 		const actual_request_handle_t & req,
 		target_path_holder_t & target_path ) const = 0;
+
+	//! An attempt to match a request target against the route
+	//! without a check of HTTP method.
+	/*!
+	 * It's used when the method is already checked by the router.
+	 *
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	virtual expected_t< request_handling_status_t, no_match_t >
+	try_handle_target_path(
+		const actual_request_handle_t & req,
+		target_path_holder_t & target_path ) const = 0;
+
+	//! Get the matcher of HTTP method.
+	/*!
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	virtual const method_matcher_t &
+	method_matcher() const noexcept = 0;
 };
 
 /*!
@@ -140,17 +162,35 @@ public:
 	{
 		if( m_method_matcher->match( req->header().method() ) )
 		{
-			auto parse_result = easy_parser::try_parse(
-					target_path.view(),
-					m_producer );
-			if( parse_result )
-			{
-				return Producer::invoke_handler( req, m_handler, *parse_result );
-			}
+			return try_handle_target_path( req, target_path );
+		}
+
+		return make_unexpected( no_match_t{} );
+	}
+
+	[[nodiscard]]
+	expected_t< request_handling_status_t, no_match_t >
+	try_handle_target_path(
+		const actual_request_handle_t & req,
+		target_path_holder_t & target_path ) const override
+	{
+		auto parse_result = easy_parser::try_parse(
+				target_path.view(),
+				m_producer );
+		if( parse_result )
+		{
+			return Producer::invoke_handler( req, m_handler, *parse_result );
 		}
 
 		return make_unexpected( no_match_t{} );
 	}
+
+	[[nodiscard]]
+	const method_matcher_t &
+	method_matcher() const noexcept override
+	{
+		return *m_method_matcher;
+	}
 };
 
 //
@@ -972,10 +1012,17 @@ public:
 		if( path_to_inspect.size() > 1u && '/' == path_to_inspect.back() )
 			path_to_inspect.remove_suffix( 1u );
 
-		target_path_holder_t target_path{ path_to_inspect };
-		for( const auto & entry : m_entries )
+		// The request target isn't copied if it's possible.
+		target_path_holder_t target_path{ path_to_inspect, req };
+
+		// Only routes that can accept the method are checked.
+		for( const auto & e :
+				m_dispatch_table.entries_for( req->header().method() ) )
 		{
-			const auto r = entry->try_handle( req, target_path );
+			const auto & entry = m_entries[ e.m_index ];
+			const auto r = e.m_method_checked ?
+				entry->try_handle_target_path( req, target_path ) :
+				entry->try_handle( req, target_path );
 			if( r )
 			{
 				return *r;
@@ -1017,6 +1064,10 @@ public:
 				std::forward<Handler>(handler) );
 
 		m_entries.push_back( std::move(entry) );
+
+		m_dispatch_table.add(
+				m_entries.size() - 1u,
+				m_entries.back()->method_matcher() );
 	}
 
 	//! Set handler for HTTP GET request.
@@ -1099,6 +1150,12 @@ private:
 
 	entries_container_t m_entries;
 
+	//! Indexes of routes grouped by HTTP method.
+	/*!
+	 * @since v.0.7.10
+	 */
+	restinio::router::impl::method_dispatch_table_t m_dispatch_table;
+
 	//! Handler that is called for requests that don't match any route.
 	generic_non_matched_request_handler_t< extra_data_t >
 			m_non_matched_request_handler;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <restinio/router/impl/target_path_holder.hpp>
+#include <restinio/router/impl/method_dispatch_table.hpp>
 #include <restinio/router/non_matched_request_handler.hpp>
 
 #include <restinio/path2regex/path2regex.hpp>
@@ -18,6 +19,7 @@
 
 #include <restinio/utils/from_string.hpp>
 #include <restinio/utils/percent_encoding.hpp>
+#include <restinio/utils/small_vector.hpp>
 
 #include <map>
 #include <optional>
@@ -52,14 +54,29 @@ struct route_params_accessor_t;
 	instance to which this parameter bind belongs.
 	String view is valid during route_params_t
 	instance life time.
+
+	Since v.0.7.10 up to 8 parameters are stored without memory
+	allocation. Values of parameters can refer to the request target
+	inside the request object if the target doesn't need normalization.
+	In that case route_params_t instance holds a reference to the request
+	object, so the request object lives at least as long as
+	route_params_t instance.
 */
 class route_params_t final
 {
 	public:
+		/*!
+		 * @note
+		 * Since v.0.7.10 it's utils::small_vector_t instead of std::vector.
+		 */
 		using named_parameters_container_t =
-			std::vector< std::pair< string_view_t, string_view_t > >;
+			utils::small_vector_t< std::pair< string_view_t, string_view_t >, 8u >;
+		/*!
+		 * @note
+		 * Since v.0.7.10 it's utils::small_vector_t instead of std::vector.
+		 */
 		using indexed_parameters_container_t =
-			std::vector< string_view_t >;
+			utils::small_vector_t< string_view_t, 8u >;
 
 	private:
 		friend struct impl::route_params_accessor_t;
@@ -67,12 +84,14 @@ class route_params_t final
 		void
 		match(
 			std::unique_ptr< char[] > request_target,
+			std::shared_ptr< const void > request_target_owner,
 			std::shared_ptr< std::string > key_names_buffer,
 			string_view_t match,
 			named_parameters_container_t named_parameters,
 			indexed_parameters_container_t indexed_parameters )
 		{
 			m_request_target = std::move( request_target );
+			m_request_target_owner = std::move( request_target_owner );
 			m_key_names_buffer = std::move( key_names_buffer );
 			m_match = match;
 			m_named_parameters = std::move( named_parameters );
@@ -128,7 +147,7 @@ class route_params_t final
 						i )
 				};
 
-			return m_indexed_parameters.at( i );
+			return m_indexed_parameters[ i ];
 		}
 
 		//! Get number of parameters.
@@ -178,6 +197,14 @@ class route_params_t final
 		*/
 		std::unique_ptr< char[] > m_request_target;
 
+		//! An owner of the request target if it isn't copied.
+		/*!
+		 * It's empty if m_request_target is used.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::shared_ptr< const void > m_request_target_owner;
+
 		//! Shared buffer for string_view of named parameterts names.
 		std::shared_ptr< std::string > m_key_names_buffer;
 
@@ -206,6 +233,7 @@ struct route_params_accessor_t
 	match(
 		route_params_t & rp,
 		std::unique_ptr< char[] > request_target,
+		std::shared_ptr< const void > request_target_owner,
 		std::shared_ptr< std::string > key_names_buffer,
 		string_view_t match_,
 		route_params_t::named_parameters_container_t named_parameters,
@@ -213,6 +241,7 @@ struct route_params_accessor_t
 	{
 		rp.match(
 			std::move( request_target ),
+			std::move( request_target_owner ),
 			std::move( key_names_buffer ),
 			match_,
 			std::move( named_parameters ),
@@ -342,10 +371,10 @@ class route_matcher_t
 
 				// Data for route_params_t initialization.
 
-				auto captured_params = target_path.giveout_data();
+				const auto target_path_view = target_path.view();
 
 				const string_view_t match{
-					captured_params.get() + Regex_Engine::submatch_begin_pos( matches[0] ),
+					target_path_view.data() + Regex_Engine::submatch_begin_pos( matches[0] ),
 					Regex_Engine::submatch_end_pos( matches[0] ) -
 						Regex_Engine::submatch_begin_pos( matches[0] ) } ;
 
@@ -366,7 +395,7 @@ class route_matcher_t
 					m_param_appender_sequence[ i - 1](
 						param_appender,
 						string_view_t{
-							captured_params.get() + Regex_Engine::submatch_begin_pos( m ),
+							target_path_view.data() + Regex_Engine::submatch_begin_pos( m ),
 							Regex_Engine::submatch_end_pos( m ) -
 								Regex_Engine::submatch_begin_pos( m ) } );
 				}
@@ -375,13 +404,14 @@ class route_matcher_t
 				{
 					m_param_appender_sequence[ i - 1 ](
 						param_appender,
-						string_view_t{ captured_params.get(), 0 } );
+						string_view_t{ target_path_view.data(), 0 } );
 				}
 
 				// Init route parameters.
 				route_params_accessor_t::match(
 						parameters,
-						std::move( captured_params ),
+						target_path.giveout_data(),
+						target_path.giveout_owner(),
 						m_named_params_buffer, // Do not move (it is used on each match).
 						std::move( match ),
 						std::move( named_parameters ),
@@ -403,6 +433,75 @@ class route_matcher_t
 					match_route( target_path, parameters );
 		}
 
+		//! Check only the HTTP method of a request.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		match_method( http_method_id_t method ) const
+		{
+			return m_method_matcher->match( method );
+		}
+
+		//! Get the matcher of HTTP method.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		const method_matcher_t &
+		method_matcher() const noexcept
+		{
+			return *m_method_matcher;
+		}
+
+		//! Get the regex of a route.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		const regex_t &
+		route_regex() const noexcept
+		{
+			return m_route_regex;
+		}
+
+		//! Init route parameters with values extracted without regex.
+		/*!
+		 * @attention
+		 * @a match and @a values must refer to the data of @a target_path.
+		 * There must be a value for every parameter of the route.
+		 *
+		 * @since v.0.7.10
+		 */
+		void
+		set_route_params(
+			target_path_holder_t & target_path,
+			string_view_t match,
+			const string_view_t * values,
+			std::size_t values_count,
+			route_params_t & parameters ) const
+		{
+			assert( m_param_appender_sequence.size() == values_count );
+
+			route_params_t::named_parameters_container_t named_parameters;
+			route_params_t::indexed_parameters_container_t indexed_parameters;
+
+			route_params_appender_t param_appender{ named_parameters, indexed_parameters };
+			for( std::size_t i = 0; i != values_count; ++i )
+				m_param_appender_sequence[ i ]( param_appender, values[ i ] );
+
+			// The buffer is moved, so the views remain valid.
+			route_params_accessor_t::match(
+					parameters,
+					target_path.giveout_data(),
+					target_path.giveout_owner(),
+					m_named_params_buffer,
+					match,
+					std::move( named_parameters ),
+					std::move( indexed_parameters ) );
+		}
+
 	private:
 		//! HTTP method to match.
 		buffered_matcher_holder_t m_method_matcher;
@@ -552,6 +651,42 @@ class generic_express_route_entry_t
 			return m_matcher( h, target_path, params );
 		}
 
+		//! Checks if request target matches entry (without a check of
+		//! HTTP method), and if so, set route params.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		bool
+		match_target_path(
+			impl::target_path_holder_t & target_path,
+			route_params_t & params ) const
+		{
+			return m_matcher.match_route( target_path, params );
+		}
+
+		//! Get the matcher of HTTP method.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		const method_matcher_t &
+		method_matcher() const noexcept
+		{
+			return m_matcher.method_matcher();
+		}
+
+		//! Get the regex of a route.
+		/*!
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		const typename Regex_Engine::compiled_regex_t &
+		route_regex() const noexcept
+		{
+			return m_matcher.route_regex();
+		}
+
 		//! Calls a handler of given request with given params.
 		[[nodiscard]]
 		request_handling_status_t
@@ -633,11 +768,19 @@ class generic_express_router_t
 		request_handling_status_t
 		operator()( actual_request_handle_t req ) const
 		{
-			impl::target_path_holder_t target_path{ req->header().path() };
+			// The request target isn't copied if it's possible.
+			impl::target_path_holder_t target_path{ req->header().path(), req };
 			route_params_t params;
-			for( const auto & entry : m_handlers )
+
+			// Only routes that can accept the method are checked.
+			for( const auto & e :
+					m_dispatch_table.entries_for( req->header().method() ) )
 			{
-				if( entry.match( req->header(), target_path, params ) )
+				const auto & entry = m_handlers[ e.m_index ];
+				const bool matched = e.m_method_checked ?
+					entry.match_target_path( target_path, params ) :
+					entry.match( req->header(), target_path, params );
+				if( matched )
 				{
 					return entry.handle( std::move( req ), std::move( params ) );
 				}
@@ -684,6 +827,10 @@ class generic_express_router_t
 					route_path,
 					options,
 					std::move( handler ) );
+
+			m_dispatch_table.add(
+					m_handlers.size() - 1u,
+					m_handlers.back().method_matcher() );
 		}
 
 		void
@@ -823,6 +970,12 @@ class generic_express_router_t
 		//! A list of existing routes.
 		std::vector< route_entry_t > m_handlers;
 
+		//! Indexes of routes grouped by HTTP method.
+		/*!
+		 * @since v.0.7.10
+		 */
+		impl::method_dispatch_table_t m_dispatch_table;
+
 		//! Handler that is called for requests that don't match any route.
 		non_matched_handler_t m_non_matched_request_handler;
 };
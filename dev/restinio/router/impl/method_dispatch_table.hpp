@@ -0,0 +1,136 @@
+/*
+ * RESTinio
+ */
+
+/**
+ * @file
+ * @brief Grouping of routes by HTTP method.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/router/method_matcher.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace restinio
+{
+
+namespace router
+{
+
+namespace impl
+{
+
+//
+// method_dispatch_table_t
+//
+/*!
+ * @brief A table of routes grouped by HTTP method.
+ *
+ * Routes are identified by indexes in a container of the router. For
+ * every method listed by method_matcher_t::accepted_methods() of some
+ * route there is a bucket with indexes of routes that can accept that
+ * method. Routes which matchers can't list their methods are added to
+ * every bucket (and to the list for other methods). The order of
+ * routes is kept in every bucket.
+ *
+ * @since v.0.7.10
+ */
+class method_dispatch_table_t
+{
+	public:
+		//! Description of a route in a bucket.
+		struct entry_t
+		{
+			//! Index of the route.
+			std::size_t m_index;
+
+			//! Is the method already checked by the selection of the bucket?
+			/*!
+			 * If it's false then method_matcher_t::match() has to be
+			 * called for the route.
+			 */
+			bool m_method_checked;
+		};
+
+		using entries_container_t = std::vector< entry_t >;
+
+		//! Add a route.
+		/*!
+		 * @attention
+		 * Routes have to be added in ascending order of indexes.
+		 */
+		void
+		add( std::size_t index, const method_matcher_t & matcher )
+		{
+			auto methods = matcher.accepted_methods();
+			if( methods )
+			{
+				std::sort( methods->begin(), methods->end() );
+				methods->erase(
+						std::unique( methods->begin(), methods->end() ),
+						methods->end() );
+
+				for( const auto & m : *methods )
+					bucket_for( m ).push_back( entry_t{ index, true } );
+			}
+			else
+			{
+				m_other_methods_entries.push_back( entry_t{ index, false } );
+				for( auto & b : m_buckets )
+					b.m_entries.push_back( entry_t{ index, false } );
+			}
+		}
+
+		//! Get routes that can accept @a method.
+		[[nodiscard]]
+		const entries_container_t &
+		entries_for( const http_method_id_t & method ) const noexcept
+		{
+			for( const auto & b : m_buckets )
+				if( b.m_method == method )
+					return b.m_entries;
+
+			return m_other_methods_entries;
+		}
+
+	private:
+		struct bucket_t
+		{
+			http_method_id_t m_method;
+			entries_container_t m_entries;
+		};
+
+		[[nodiscard]]
+		entries_container_t &
+		bucket_for( const http_method_id_t & method )
+		{
+			for( auto & b : m_buckets )
+				if( b.m_method == method )
+					return b.m_entries;
+
+			// Routes for any method added before have to be in the new bucket.
+			m_buckets.push_back( bucket_t{ method, m_other_methods_entries } );
+			return m_buckets.back().m_entries;
+		}
+
+		//! Buckets for methods listed by matchers.
+		/*!
+		 * There are only a few methods in a typical router, so
+		 * a linear search is used.
+		 */
+		std::vector< bucket_t > m_buckets;
+
+		//! Routes that can accept methods without own buckets.
+		entries_container_t m_other_methods_entries;
+};
+
+} /* namespace impl */
+
+} /* namespace router */
+
+} /* namespace restinio */
@@ -0,0 +1,1927 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Implementation of the in-tree regex engine for express router.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/impl/include_fmtlib.hpp>
+
+#include <restinio/exception.hpp>
+#include <restinio/string_view.hpp>
+#include <restinio/utils/small_vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace restinio
+{
+
+namespace router
+{
+
+namespace impl
+{
+
+namespace nfa_regex
+{
+
+//! Max value for a counted repetition like `\d{1,1000}`.
+constexpr std::size_t max_repetitions = 1000u;
+
+//! Max count of instructions in a compiled regex.
+constexpr std::size_t max_program_size = 64u * 1024u;
+
+//! Max count of states of a DFA for a single regex.
+constexpr std::size_t max_dfa_states = 512u;
+
+//! Value of a counted repetition without an upper bound.
+constexpr std::size_t unbounded = std::numeric_limits< std::size_t >::max();
+
+//! Value of a capture slot that wasn't set.
+constexpr std::size_t unset_slot = std::numeric_limits< std::size_t >::max();
+
+using char_set_t = std::bitset< 256 >;
+
+//! Results of a match.
+/*!
+ * Pairs of [begin, end) positions for the whole match and for every
+ * capture group. Groups that didn't participate in the match
+ * have empty values at the position 0.
+ */
+using match_results_t =
+	restinio::utils::small_vector_t< std::pair< std::size_t, std::size_t >, 16u >;
+
+[[nodiscard]]
+inline bool
+is_word_char( char c ) noexcept
+{
+	return ( 'a' <= c && c <= 'z' ) || ( 'A' <= c && c <= 'Z' ) ||
+		( '0' <= c && c <= '9' ) || '_' == c;
+}
+
+[[nodiscard]]
+inline unsigned char
+to_uchar( char c ) noexcept
+{
+	return static_cast< unsigned char >( c );
+}
+
+//
+// node_t
+//
+
+enum class node_type_t : std::uint8_t
+{
+	empty,
+	character,
+	char_set,
+	begin_of_input,
+	end_of_input,
+	word_boundary,
+	not_word_boundary,
+	capture,
+	concatenation,
+	alternation,
+	repetition,
+	lookahead,
+	negative_lookahead
+};
+
+//! A node of the syntax tree of a regex.
+struct node_t
+{
+	node_type_t m_type{ node_type_t::empty };
+
+	//! A char for node_type_t::character.
+	char m_char{};
+
+	//! Index of a char set or a capture group.
+	std::size_t m_index{};
+
+	//! Bounds for node_type_t::repetition.
+	//! @{
+	std::size_t m_min{};
+	std::size_t m_max{};
+	bool m_greedy{ true };
+	//! @}
+
+	std::vector< node_t > m_children;
+};
+
+[[nodiscard]]
+inline node_t
+make_node( node_type_t type )
+{
+	node_t n;
+	n.m_type = type;
+	return n;
+}
+
+//
+// parser_t
+//
+
+//! A parser of ECMAScript-like regexes.
+/*!
+ * The supported subset is enough for regexes produced by path2regex
+ * and for typical patterns of route parameters: literals, escapes,
+ * `.`, char classes, `\d \w \s \D \W \S`, groups (capturing,
+ * non-capturing and lookaheads), alternations, greedy and lazy
+ * quantifiers (including counted ones), `^`, `$`, `\b` and `\B`.
+ *
+ * Backreferences and lookbehinds are not supported, an exception
+ * is thrown for them.
+ */
+class parser_t
+{
+	public:
+		parser_t(
+			string_view_t pattern,
+			bool icase,
+			std::vector< char_set_t > & char_sets )
+			:	m_pattern{ pattern }
+			,	m_icase{ icase }
+			,	m_char_sets{ char_sets }
+		{}
+
+		[[nodiscard]]
+		node_t
+		parse()
+		{
+			auto result = parse_alternation();
+			if( m_pos != m_pattern.size() )
+				fail( "unmatched ')'" );
+
+			return result;
+		}
+
+		//! Count of capture groups (including the whole match).
+		[[nodiscard]]
+		std::size_t
+		captures_count() const noexcept { return m_captures_count; }
+
+	private:
+		string_view_t m_pattern;
+		const bool m_icase;
+		std::vector< char_set_t > & m_char_sets;
+
+		std::size_t m_pos{ 0u };
+		std::size_t m_captures_count{ 1u };
+
+		[[noreturn]]
+		void
+		fail( const char * what ) const
+		{
+			throw exception_t{
+				fmt::format(
+					RESTINIO_FMT_FORMAT_STRING( "{} at pos {}" ),
+					what,
+					m_pos ) };
+		}
+
+		[[nodiscard]]
+		bool
+		at_end() const noexcept { return m_pos == m_pattern.size(); }
+
+		[[nodiscard]]
+		char
+		current() const noexcept { return m_pattern[ m_pos ]; }
+
+		[[nodiscard]]
+		bool
+		try_consume( char c ) noexcept
+		{
+			if( !at_end() && c == current() )
+			{
+				++m_pos;
+				return true;
+			}
+
+			return false;
+		}
+
+		[[nodiscard]]
+		node_t
+		make_char_set_node( char_set_t set )
+		{
+			if( m_icase )
+			{
+				for( char c = 'a'; c <= 'z'; ++c )
+				{
+					const char u = static_cast< char >( c - 'a' + 'A' );
+					if( set.test( to_uchar( c ) ) || set.test( to_uchar( u ) ) )
+					{
+						set.set( to_uchar( c ) );
+						set.set( to_uchar( u ) );
+					}
+				}
+			}
+
+			auto n = make_node( node_type_t::char_set );
+			n.m_index = m_char_sets.size();
+			m_char_sets.push_back( set );
+
+			return n;
+		}
+
+		[[nodiscard]]
+		node_t
+		make_char_node( char c )
+		{
+			const bool is_letter =
+				( 'a' <= c && c <= 'z' ) || ( 'A' <= c && c <= 'Z' );
+			if( m_icase && is_letter )
+			{
+				char_set_t set;
+				set.set( to_uchar( c ) );
+				return make_char_set_node( set );
+			}
+
+			auto n = make_node( node_type_t::character );
+			n.m_char = c;
+
+			return n;
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_alternation()
+		{
+			auto first = parse_concatenation();
+			if( at_end() || '|' != current() )
+				return first;
+
+			auto result = make_node( node_type_t::alternation );
+			result.m_children.push_back( std::move( first ) );
+			while( try_consume( '|' ) )
+				result.m_children.push_back( parse_concatenation() );
+
+			return result;
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_concatenation()
+		{
+			auto result = make_node( node_type_t::concatenation );
+			while( !at_end() && '|' != current() && ')' != current() )
+				result.m_children.push_back( parse_quantified() );
+
+			if( 1u == result.m_children.size() )
+				return std::move( result.m_children.front() );
+
+			return result;
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_quantified()
+		{
+			auto atom = parse_atom();
+
+			std::size_t min{};
+			std::size_t max{};
+			if( !try_parse_quantifier( min, max ) )
+				return atom;
+
+			switch( atom.m_type )
+			{
+				case node_type_t::begin_of_input:
+				case node_type_t::end_of_input:
+				case node_type_t::word_boundary:
+				case node_type_t::not_word_boundary:
+					fail( "nothing to repeat" );
+
+				default:
+					break;
+			}
+
+			auto result = make_node( node_type_t::repetition );
+			result.m_min = min;
+			result.m_max = max;
+			result.m_greedy = !try_consume( '?' );
+			result.m_children.push_back( std::move( atom ) );
+
+			return result;
+		}
+
+		[[nodiscard]]
+		bool
+		try_parse_quantifier( std::size_t & min, std::size_t & max )
+		{
+			if( at_end() )
+				return false;
+
+			switch( current() )
+			{
+				case '*': ++m_pos; min = 0u; max = unbounded; return true;
+				case '+': ++m_pos; min = 1u; max = unbounded; return true;
+				case '?': ++m_pos; min = 0u; max = 1u; return true;
+				case '{': return try_parse_counted_quantifier( min, max );
+				default: return false;
+			}
+		}
+
+		//! Parse `{n}`, `{n,}` or `{n,m}`.
+		/*!
+		 * If the text isn't a valid quantifier then `{` is a literal
+		 * (as in ECMAScript without Unicode mode).
+		 */
+		[[nodiscard]]
+		bool
+		try_parse_counted_quantifier( std::size_t & min, std::size_t & max )
+		{
+			const auto start = m_pos;
+			++m_pos;
+
+			if( !try_parse_number( min ) )
+			{
+				m_pos = start;
+				return false;
+			}
+
+			if( try_consume( ',' ) )
+			{
+				if( !try_parse_number( max ) )
+					max = unbounded;
+			}
+			else
+				max = min;
+
+			if( !try_consume( '}' ) )
+			{
+				m_pos = start;
+				return false;
+			}
+
+			if( min > max )
+				fail( "numbers out of order in {} quantifier" );
+			if( min > max_repetitions ||
+					( unbounded != max && max > max_repetitions ) )
+				fail( "too big number in {} quantifier" );
+
+			return true;
+		}
+
+		[[nodiscard]]
+		bool
+		try_parse_number( std::size_t & value ) noexcept
+		{
+			const auto start = m_pos;
+			value = 0u;
+			while( !at_end() && '0' <= current() && current() <= '9' )
+			{
+				// A value greater than max_repetitions is detected later.
+				if( value <= max_repetitions )
+					value = value * 10u + static_cast< std::size_t >( current() - '0' );
+				++m_pos;
+			}
+
+			return start != m_pos;
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_atom()
+		{
+			const char c = current();
+			switch( c )
+			{
+				case '(':
+					++m_pos;
+					return parse_group();
+
+				case ')':
+					fail( "unmatched ')'" );
+
+				case '*': case '+': case '?':
+					fail( "nothing to repeat" );
+
+				case '.':
+				{
+					++m_pos;
+					char_set_t set;
+					set.set();
+					set.reset( to_uchar( '\n' ) );
+					set.reset( to_uchar( '\r' ) );
+					return make_char_set_node( set );
+				}
+
+				case '^':
+					++m_pos;
+					return make_node( node_type_t::begin_of_input );
+
+				case '$':
+					++m_pos;
+					return make_node( node_type_t::end_of_input );
+
+				case '[':
+					++m_pos;
+					return parse_char_class();
+
+				case '\\':
+					++m_pos;
+					return parse_escape();
+
+				default:
+					++m_pos;
+					return make_char_node( c );
+			}
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_group()
+		{
+			node_t result;
+			if( try_consume( '?' ) )
+			{
+				if( try_consume( ':' ) )
+					result = parse_alternation();
+				else if( try_consume( '=' ) )
+				{
+					result = make_node( node_type_t::lookahead );
+					result.m_children.push_back( parse_alternation() );
+				}
+				else if( try_consume( '!' ) )
+				{
+					result = make_node( node_type_t::negative_lookahead );
+					result.m_children.push_back( parse_alternation() );
+				}
+				else
+					fail( "unsupported group type" );
+			}
+			else
+			{
+				result = make_node( node_type_t::capture );
+				result.m_index = m_captures_count++;
+				result.m_children.push_back( parse_alternation() );
+			}
+
+			if( !try_consume( ')' ) )
+				fail( "missing ')'" );
+
+			return result;
+		}
+
+		//! Try to handle `\d`, `\w`, `\s` and their negations.
+		[[nodiscard]]
+		bool
+		try_parse_class_escape( char c, char_set_t & set ) const noexcept
+		{
+			char_set_t s;
+			switch( c )
+			{
+				case 'd': case 'D':
+					for( char ch = '0'; ch <= '9'; ++ch )
+						s.set( to_uchar( ch ) );
+				break;
+
+				case 'w': case 'W':
+					for( std::size_t ch = 0u; ch != s.size(); ++ch )
+						if( is_word_char( static_cast< char >( ch ) ) )
+							s.set( ch );
+				break;
+
+				case 's': case 'S':
+					for( const char ch : { ' ', '\t', '\n', '\r', '\f', '\v' } )
+						s.set( to_uchar( ch ) );
+				break;
+
+				default:
+					return false;
+			}
+
+			if( 'D' == c || 'W' == c || 'S' == c )
+				s.flip();
+
+			set |= s;
+			return true;
+		}
+
+		//! Parse an escaped char (the backslash is already consumed).
+		[[nodiscard]]
+		char
+		parse_escaped_char( bool in_class )
+		{
+			if( at_end() )
+				fail( "\\ at end of pattern" );
+
+			const char c = current();
+			++m_pos;
+			switch( c )
+			{
+				case 'n': return '\n';
+				case 'r': return '\r';
+				case 't': return '\t';
+				case 'f': return '\f';
+				case 'v': return '\v';
+				case '0': return '\0';
+				case 'b':
+					if( in_class )
+						return '\b';
+				break;
+
+				case 'x':
+				{
+					int value = 0;
+					for( int i = 0; i != 2; ++i )
+					{
+						if( at_end() )
+							fail( "invalid \\x escape" );
+
+						const char h = current();
+						int digit{};
+						if( '0' <= h && h <= '9' ) digit = h - '0';
+						else if( 'a' <= h && h <= 'f' ) digit = h - 'a' + 10;
+						else if( 'A' <= h && h <= 'F' ) digit = h - 'A' + 10;
+						else fail( "invalid \\x escape" );
+
+						value = value * 16 + digit;
+						++m_pos;
+					}
+					return static_cast< char >( value );
+				}
+
+				default:
+					break;
+			}
+
+			if( '1' <= c && c <= '9' )
+				fail( "backreferences are not supported" );
+
+			// Any other char is taken as is.
+			return c;
+		}
+
+		[[nodiscard]]
+		node_t
+		parse_escape()
+		{
+			if( at_end() )
+				fail( "\\ at end of pattern" );
+
+			switch( current() )
+			{
+				case 'b':
+					++m_pos;
+					return make_node( node_type_t::word_boundary );
+
+				case 'B':
+					++m_pos;
+					return make_node( node_type_t::not_word_boundary );
+
+				default:
+					break;
+			}
+
+			char_set_t set;
+			if( try_parse_class_escape( current(), set ) )
+			{
+				++m_pos;
+				return make_char_set_node( set );
+			}
+
+			return make_char_node( parse_escaped_char( false ) );
+		}
+
+		//! Parse a char class (the opening bracket is already consumed).
+		[[nodiscard]]
+		node_t
+		parse_char_class()
+		{
+			const bool negative = try_consume( '^' );
+
+			char_set_t set;
+			while( !try_consume( ']' ) )
+			{
+				if( at_end() )
+					fail( "missing ']'" );
+
+				char first{};
+				if( !parse_class_atom( set, first ) )
+					continue;
+
+				// Check for a range.
+				if( m_pos + 1u < m_pattern.size() &&
+						'-' == current() && ']' != m_pattern[ m_pos + 1u ] )
+				{
+					++m_pos;
+					char last{};
+					if( !parse_class_atom( set, last ) )
+					{
+						// Something like [a-\d], '-' is a literal.
+						set.set( to_uchar( first ) );
+						set.set( to_uchar( '-' ) );
+						continue;
+					}
+
+					if( to_uchar( first ) > to_uchar( last ) )
+						fail( "range out of order in character class" );
+
+					for( auto ch = to_uchar( first ); ch != to_uchar( last ); ++ch )
+						set.set( ch );
+					set.set( to_uchar( last ) );
+				}
+				else
+					set.set( to_uchar( first ) );
+			}
+
+			if( m_icase )
+			{
+				// The set is folded before the negation:
+				// [^a] has to match neither 'a' nor 'A'.
+				auto n = make_char_set_node( set );
+				if( negative )
+					m_char_sets[ n.m_index ].flip();
+				return n;
+			}
+
+			if( negative )
+				set.flip();
+
+			return make_char_set_node( set );
+		}
+
+		//! Parse an item of a char class.
+		/*!
+		 * @return true if the item is a single char stored to @a ch.
+		 * Otherwise the item is a class escape that is added to @a set.
+		 */
+		[[nodiscard]]
+		bool
+		parse_class_atom( char_set_t & set, char & ch )
+		{
+			const char c = current();
+			++m_pos;
+			if( '\\' != c )
+			{
+				ch = c;
+				return true;
+			}
+
+			if( !at_end() && try_parse_class_escape( current(), set ) )
+			{
+				++m_pos;
+				return false;
+			}
+
+			ch = parse_escaped_char( true );
+			return true;
+		}
+};
+
+//
+// instruction_t
+//
+
+enum class opcode_t : std::uint8_t
+{
+	character,
+	char_set,
+	//! Try m_x first, then m_y.
+	split,
+	jump,
+	save,
+	begin_of_input,
+	end_of_input,
+	word_boundary,
+	not_word_boundary,
+	//! m_x is the start of a sub-program.
+	lookahead,
+	negative_lookahead,
+	match
+};
+
+struct instruction_t
+{
+	opcode_t m_opcode;
+	char m_char;
+	std::uint32_t m_x;
+	std::uint32_t m_y;
+};
+
+//
+// compiler_t
+//
+
+//! A compiler of a syntax tree into a program for pike VM.
+class compiler_t
+{
+	public:
+		explicit compiler_t( std::vector< instruction_t > & code )
+			:	m_code{ code }
+		{}
+
+		void
+		compile( const node_t & root )
+		{
+			add( opcode_t::save, 0u );
+			emit( root );
+			add( opcode_t::save, 1u );
+			add( opcode_t::match );
+
+			// Sub-programs for lookaheads are placed after the main one.
+			// New lookaheads can be found during the compilation.
+			for( std::size_t i = 0u; i != m_lookaheads.size(); ++i )
+			{
+				m_code[ m_lookaheads[ i ].first ].m_x = next_pc();
+				emit( *( m_lookaheads[ i ].second ) );
+				add( opcode_t::match );
+			}
+		}
+
+	private:
+		std::vector< instruction_t > & m_code;
+
+		//! Lookahead instructions with their bodies.
+		std::vector< std::pair< std::uint32_t, const node_t * > > m_lookaheads;
+
+		[[nodiscard]]
+		std::uint32_t
+		next_pc() const noexcept
+		{
+			return static_cast< std::uint32_t >( m_code.size() );
+		}
+
+		std::uint32_t
+		add(
+			opcode_t opcode,
+			std::uint32_t x = 0u,
+			std::uint32_t y = 0u,
+			char c = 0 )
+		{
+			if( max_program_size == m_code.size() )
+				throw exception_t{ "regex is too big" };
+
+			m_code.push_back( instruction_t{ opcode, c, x, y } );
+			return static_cast< std::uint32_t >( m_code.size() - 1u );
+		}
+
+		void
+		emit( const node_t & n )
+		{
+			switch( n.m_type )
+			{
+				case node_type_t::empty:
+				break;
+
+				case node_type_t::character:
+					add( opcode_t::character, 0u, 0u, n.m_char );
+				break;
+
+				case node_type_t::char_set:
+					add( opcode_t::char_set, static_cast< std::uint32_t >( n.m_index ) );
+				break;
+
+				case node_type_t::begin_of_input:
+					add( opcode_t::begin_of_input );
+				break;
+
+				case node_type_t::end_of_input:
+					add( opcode_t::end_of_input );
+				break;
+
+				case node_type_t::word_boundary:
+					add( opcode_t::word_boundary );
+				break;
+
+				case node_type_t::not_word_boundary:
+					add( opcode_t::not_word_boundary );
+				break;
+
+				case node_type_t::capture:
+				{
+					const auto slot = static_cast< std::uint32_t >( n.m_index * 2u );
+					add( opcode_t::save, slot );
+					emit( n.m_children.front() );
+					add( opcode_t::save, slot + 1u );
+				}
+				break;
+
+				case node_type_t::concatenation:
+					for( const auto & c : n.m_children )
+						emit( c );
+				break;
+
+				case node_type_t::alternation:
+					emit_alternation( n );
+				break;
+
+				case node_type_t::repetition:
+					emit_repetition( n );
+				break;
+
+				case node_type_t::lookahead:
+					m_lookaheads.emplace_back(
+							add( opcode_t::lookahead ), &n.m_children.front() );
+				break;
+
+				case node_type_t::negative_lookahead:
+					m_lookaheads.emplace_back(
+							add( opcode_t::negative_lookahead ), &n.m_children.front() );
+				break;
+			}
+		}
+
+		void
+		emit_alternation( const node_t & n )
+		{
+			std::vector< std::uint32_t > jumps_to_end;
+			for( std::size_t i = 0u; i != n.m_children.size(); ++i )
+			{
+				if( i + 1u != n.m_children.size() )
+				{
+					const auto split = add( opcode_t::split );
+					m_code[ split ].m_x = next_pc();
+					emit( n.m_children[ i ] );
+					jumps_to_end.push_back( add( opcode_t::jump ) );
+					m_code[ split ].m_y = next_pc();
+				}
+				else
+					emit( n.m_children[ i ] );
+			}
+
+			for( const auto j : jumps_to_end )
+				m_code[ j ].m_x = next_pc();
+		}
+
+		void
+		emit_repetition( const node_t & n )
+		{
+			const auto & body = n.m_children.front();
+
+			for( std::size_t i = 0u; i != n.m_min; ++i )
+				emit( body );
+
+			if( unbounded == n.m_max )
+			{
+				// L: split body, end
+				//    body
+				//    jump L
+				// end:
+				const auto split = add( opcode_t::split );
+				emit( body );
+				add( opcode_t::jump, split );
+				set_split_targets( split, split + 1u, next_pc(), n.m_greedy );
+			}
+			else
+			{
+				// Every optional item has a way to the end of the whole sequence:
+				// (body(body)?)?
+				std::vector< std::uint32_t > splits;
+				for( std::size_t i = n.m_min; i != n.m_max; ++i )
+				{
+					splits.push_back( add( opcode_t::split ) );
+					emit( body );
+				}
+
+				for( const auto s : splits )
+					set_split_targets( s, s + 1u, next_pc(), n.m_greedy );
+			}
+		}
+
+		void
+		set_split_targets(
+			std::uint32_t split,
+			std::uint32_t body,
+			std::uint32_t end,
+			bool greedy ) noexcept
+		{
+			m_code[ split ].m_x = greedy ? body : end;
+			m_code[ split ].m_y = greedy ? end : body;
+		}
+};
+
+//
+// lazy_dfa_t
+//
+
+//! A DFA that checks the presence of a match without captures.
+/*!
+ * A DFA is built from a program for pike VM by the subset construction.
+ * States are built on demand (only states that are reached by real
+ * texts are created), so a DFA can be used even for a program of
+ * thousands of routes. Bytes are grouped into classes (bytes of a class
+ * are handled by all instructions in the same way), so rows of
+ * transitions are small.
+ *
+ * A program can have several entry points (see start_t) and several
+ * `match` instructions. The value of m_x of a `match` instruction is
+ * an id that is reported when this instruction is reached.
+ *
+ * An object is thread-safe: transitions are read without locking and new
+ * states are added under a mutex.
+ *
+ * The count of states is limited. States aren't flushed when the limit is
+ * reached because readers use them without locking. Instead the DFA
+ * becomes saturated: transitions that are already known are still used,
+ * but every transition that isn't known yet gives result_t::unknown
+ * immediately (without locking and memory allocations), so the caller
+ * can use a fallback.
+ *
+ * A DFA can't be used for programs with `\b`, `\B` and lookaheads
+ * (see is_applicable()).
+ */
+class lazy_dfa_t
+{
+	public:
+		//! An entry point of a program.
+		struct start_t
+		{
+			std::uint32_t m_pc;
+			//! Can a match start at any position?
+			bool m_search;
+		};
+
+		enum class result_t
+		{
+			no_match,
+			match,
+			//! The limit of states is reached, the result is unknown.
+			unknown
+		};
+
+		//! Ids of reached `match` instructions.
+		using ids_container_t = std::vector< std::uint32_t >;
+
+		lazy_dfa_t(
+			std::vector< instruction_t > code,
+			const std::vector< char_set_t > & char_sets,
+			const std::vector< start_t > & starts,
+			std::size_t max_states )
+			:	m_code{ std::move( code ) }
+			,	m_char_sets{ char_sets }
+			,	m_max_states{ std::max< std::size_t >( max_states, 2u ) }
+			,	m_states{ std::make_unique< state_t[] >( m_max_states ) }
+		{
+			make_byte_classes();
+
+			pc_set_t initial;
+			for( const auto & s : starts )
+			{
+				initial.push_back( s.m_pc );
+				if( s.m_search )
+					m_search_start.push_back( s.m_pc );
+			}
+			m_search_start = closure( std::move( m_search_start ), false, false );
+
+			// The dead state.
+			add_state( pc_set_t{}, false );
+			add_state( closure( std::move( initial ), true, false ), true );
+		}
+
+		lazy_dfa_t( const lazy_dfa_t & ) = delete;
+		lazy_dfa_t & operator=( const lazy_dfa_t & ) = delete;
+
+		//! Can a DFA be built for a program?
+		[[nodiscard]]
+		static bool
+		is_applicable( const std::vector< instruction_t > & code ) noexcept
+		{
+			return std::none_of( code.begin(), code.end(),
+				[]( const instruction_t & instruction ) {
+					switch( instruction.m_opcode )
+					{
+						case opcode_t::word_boundary:
+						case opcode_t::not_word_boundary:
+						case opcode_t::lookahead:
+						case opcode_t::negative_lookahead:
+							return true;
+
+						default:
+							return false;
+					}
+				} );
+		}
+
+		//! Check the presence of a match in @a text.
+		/*!
+		 * If @a ids is nullptr then the first found match is enough.
+		 * Otherwise ids of all reached `match` instructions are
+		 * added to @a ids (there can be duplicates).
+		 */
+		[[nodiscard]]
+		result_t
+		run( string_view_t text, ids_container_t * ids ) const
+		{
+			const state_t * state = &m_states[ start_state ];
+
+			for( const char c : text )
+			{
+				if( !state->m_matched_now.empty() )
+				{
+					if( !ids )
+						return result_t::match;
+					ids->insert( ids->end(),
+							state->m_matched_now.begin(), state->m_matched_now.end() );
+				}
+
+				const auto byte_class = m_byte_classes[ to_uchar( c ) ];
+				auto next = state->m_transitions[ byte_class ].load(
+						std::memory_order_acquire );
+				if( unknown_state == next )
+				{
+					if( m_saturated.load( std::memory_order_relaxed ) )
+						return result_t::unknown;
+
+					next = add_transition( *state, byte_class );
+					if( unknown_state == next )
+						return result_t::unknown;
+				}
+
+				if( dead_state == next )
+					return ids && !ids->empty() ? result_t::match : result_t::no_match;
+
+				state = &m_states[ next ];
+			}
+
+			if( state->m_matched_at_end.empty() )
+				return ids && !ids->empty() ? result_t::match : result_t::no_match;
+
+			if( ids )
+				ids->insert( ids->end(),
+						state->m_matched_at_end.begin(), state->m_matched_at_end.end() );
+
+			return result_t::match;
+		}
+
+	private:
+		//! A sorted set of program counters.
+		using pc_set_t = std::vector< std::uint32_t >;
+
+		static constexpr std::uint32_t dead_state = 0u;
+		static constexpr std::uint32_t start_state = 1u;
+		static constexpr std::uint32_t unknown_state =
+				std::numeric_limits< std::uint32_t >::max();
+
+		struct state_t
+		{
+			pc_set_t m_pcs;
+
+			//! Ids of matches found regardless of the rest of the input.
+			ids_container_t m_matched_now;
+			//! Ids of matches found if there is no more input.
+			ids_container_t m_matched_at_end;
+
+			//! Transitions for every byte class.
+			std::unique_ptr< std::atomic< std::uint32_t >[] > m_transitions;
+		};
+
+		const std::vector< instruction_t > m_code;
+		const std::vector< char_set_t > m_char_sets;
+		const std::size_t m_max_states;
+
+		std::uint8_t m_byte_classes[ 256 ]{};
+		std::size_t m_classes_count{ 0u };
+		//! A byte for every class.
+		std::vector< unsigned char > m_representatives;
+
+		//! The closure of entry points for which a match can start anywhere.
+		pc_set_t m_search_start;
+
+		//! States that are visible to readers.
+		/*!
+		 * The storage isn't reallocated, so readers don't need locks.
+		 */
+		const std::unique_ptr< state_t[] > m_states;
+
+		//! Protection of the following members and creation of states.
+		mutable std::mutex m_lock;
+		mutable std::uint32_t m_states_count{ 0u };
+		mutable std::map< pc_set_t, std::uint32_t > m_states_index;
+
+		//! Is the limit of states reached?
+		mutable std::atomic< bool > m_saturated{ false };
+
+		//! Split bytes into classes.
+		/*!
+		 * Bytes are in the same class if every char and char set
+		 * instruction either matches all of them or none.
+		 */
+		void
+		make_byte_classes()
+		{
+			std::vector< char_set_t > sets;
+			const auto add_set = [&sets]( const char_set_t & set ) {
+				if( sets.end() == std::find( sets.begin(), sets.end(), set ) )
+					sets.push_back( set );
+			};
+
+			for( const auto & instruction : m_code )
+			{
+				if( opcode_t::character == instruction.m_opcode )
+				{
+					char_set_t set;
+					set.set( to_uchar( instruction.m_char ) );
+					add_set( set );
+				}
+				else if( opcode_t::char_set == instruction.m_opcode )
+					add_set( m_char_sets[ instruction.m_x ] );
+			}
+
+			std::vector< std::vector< bool > > signatures;
+			for( std::size_t b = 0u; b != 256u; ++b )
+			{
+				std::vector< bool > signature;
+				signature.reserve( sets.size() );
+				for( const auto & set : sets )
+					signature.push_back( set.test( b ) );
+
+				const auto it = std::find(
+						signatures.begin(), signatures.end(), signature );
+				m_byte_classes[ b ] = static_cast< std::uint8_t >(
+						it - signatures.begin() );
+				if( signatures.end() == it )
+				{
+					signatures.push_back( std::move( signature ) );
+					m_representatives.push_back( static_cast< unsigned char >( b ) );
+				}
+			}
+
+			m_classes_count = signatures.size();
+		}
+
+		//! Follow epsilon-transitions.
+		/*!
+		 * The result contains only instructions that consume
+		 * input, `match` and (if @a at_end is false) `$`.
+		 */
+		[[nodiscard]]
+		pc_set_t
+		closure(
+			pc_set_t pcs,
+			bool at_begin,
+			bool at_end ) const
+		{
+			pc_set_t result;
+			std::vector< bool > visited( m_code.size(), false );
+			while( !pcs.empty() )
+			{
+				const auto pc = pcs.back();
+				pcs.pop_back();
+				if( visited[ pc ] )
+					continue;
+				visited[ pc ] = true;
+
+				const auto & instruction = m_code[ pc ];
+				switch( instruction.m_opcode )
+				{
+					case opcode_t::jump:
+						pcs.push_back( instruction.m_x );
+					break;
+
+					case opcode_t::split:
+						pcs.push_back( instruction.m_x );
+						pcs.push_back( instruction.m_y );
+					break;
+
+					case opcode_t::save:
+						pcs.push_back( pc + 1u );
+					break;
+
+					case opcode_t::begin_of_input:
+						if( at_begin )
+							pcs.push_back( pc + 1u );
+					break;
+
+					case opcode_t::end_of_input:
+						if( at_end )
+							pcs.push_back( pc + 1u );
+						else
+							result.push_back( pc );
+					break;
+
+					default:
+						result.push_back( pc );
+					break;
+				}
+			}
+
+			std::sort( result.begin(), result.end() );
+			return result;
+		}
+
+		[[nodiscard]]
+		ids_container_t
+		matched_ids( const pc_set_t & pcs ) const
+		{
+			ids_container_t result;
+			for( const auto pc : pcs )
+				if( opcode_t::match == m_code[ pc ].m_opcode )
+					result.push_back( m_code[ pc ].m_x );
+
+			return result;
+		}
+
+		//! Add a new state.
+		/*!
+		 * @attention
+		 * Must be called under m_lock (or in the constructor).
+		 *
+		 * @return unknown_state if the limit of states is reached.
+		 */
+		std::uint32_t
+		add_state( pc_set_t pcs, bool at_begin ) const
+		{
+			if( m_max_states == m_states_count )
+			{
+				m_saturated.store( true, std::memory_order_relaxed );
+				return unknown_state;
+			}
+
+			auto & state = m_states[ m_states_count ];
+			state.m_matched_now = matched_ids( pcs );
+
+			// `$` can be passed if there is no more input.
+			pc_set_t ends;
+			for( const auto pc : pcs )
+				if( opcode_t::end_of_input == m_code[ pc ].m_opcode )
+					ends.push_back( pc );
+			state.m_matched_at_end = matched_ids( closure( std::move( ends ), at_begin, true ) );
+			state.m_matched_at_end.insert( state.m_matched_at_end.end(),
+					state.m_matched_now.begin(), state.m_matched_now.end() );
+
+			state.m_transitions =
+					std::make_unique< std::atomic< std::uint32_t >[] >( m_classes_count );
+			for( std::size_t i = 0u; i != m_classes_count; ++i )
+				state.m_transitions[ i ].store( unknown_state, std::memory_order_relaxed );
+
+			m_states_index.emplace( pcs, m_states_count );
+			state.m_pcs = std::move( pcs );
+
+			return m_states_count++;
+		}
+
+		//! Calculate a transition that isn't known yet.
+		std::uint32_t
+		add_transition( const state_t & from, std::size_t byte_class ) const
+		{
+			std::lock_guard< std::mutex > lock{ m_lock };
+
+			// The transition can be added by another thread.
+			auto result = from.m_transitions[ byte_class ].load(
+					std::memory_order_relaxed );
+			if( unknown_state != result ||
+					m_saturated.load( std::memory_order_relaxed ) )
+				return result;
+
+			const auto byte = m_representatives[ byte_class ];
+			pc_set_t next;
+			for( const auto pc : from.m_pcs )
+			{
+				const auto & instruction = m_code[ pc ];
+				const bool consumed =
+					( opcode_t::character == instruction.m_opcode &&
+						to_uchar( instruction.m_char ) == byte ) ||
+					( opcode_t::char_set == instruction.m_opcode &&
+						m_char_sets[ instruction.m_x ].test( byte ) );
+				if( consumed )
+					next.push_back( pc + 1u );
+			}
+
+			next = closure( std::move( next ), false, false );
+			if( !m_search_start.empty() )
+			{
+				pc_set_t merged;
+				std::set_union(
+						next.begin(), next.end(),
+						m_search_start.begin(), m_search_start.end(),
+						std::back_inserter( merged ) );
+				next = std::move( merged );
+			}
+
+			if( next.empty() )
+				result = dead_state;
+			else
+			{
+				const auto it = m_states_index.find( next );
+				result = m_states_index.end() != it ?
+						it->second : add_state( std::move( next ), false );
+				if( unknown_state == result )
+					return result;
+			}
+
+			from.m_transitions[ byte_class ].store( result, std::memory_order_release );
+			return result;
+		}
+};
+
+class regex_set_t;
+
+//
+// regex_t
+//
+
+//! A compiled regex.
+/*!
+ * A regex is compiled into a program for a pike VM (a simulation of NFA
+ * that handles all alternatives in lock-step). Matching time is linear
+ * in the length of the input and it doesn't depend on the form of the
+ * regex (there is no backtracking). The priorities of alternatives are
+ * kept, so captures are the same as for a backtracking engine.
+ *
+ * The VM is used only if there is a match:
+ *
+ * - if a regex starts with `^` followed by a literal text then the text
+ *   is checked first. Because regexes produced by path2regex start with
+ *   a literal part of the route most of non-matching routes are rejected
+ *   by that check;
+ * - then a DFA (if it can be built for the regex) checks the presence
+ *   of a match. It's much cheaper than the VM because it handles every
+ *   char by a single lookup in a table of transitions.
+ */
+class regex_t
+{
+	friend class regex_set_t;
+
+	public:
+		regex_t() = default;
+
+		regex_t( string_view_t pattern, bool icase )
+		{
+			try
+			{
+				parser_t parser{ pattern, icase, m_char_sets };
+				const auto root = parser.parse();
+				m_captures_count = parser.captures_count();
+
+				compiler_t{ m_code }.compile( root );
+				detect_literal_prefix( root );
+				if( lazy_dfa_t::is_applicable( m_code ) )
+					m_dfa = std::make_shared< lazy_dfa_t >(
+							m_code,
+							m_char_sets,
+							std::vector< lazy_dfa_t::start_t >{ { 0u, !m_anchored } },
+							max_dfa_states );
+			}
+			catch( const std::exception & ex )
+			{
+				throw exception_t{
+					fmt::format(
+						RESTINIO_FMT_FORMAT_STRING(
+							"unable to compile regex \"{}\": {}" ),
+						fmtlib_tools::streamed( pattern ),
+						ex.what() ) };
+			}
+		}
+
+		//! Find the first match in @a text.
+		[[nodiscard]]
+		bool
+		search( string_view_t text, match_results_t & results ) const
+		{
+			if( m_code.empty() )
+				return false;
+
+			if( m_anchored &&
+				( text.size() < m_prefix.size() ||
+					0 != text.compare( 0u, m_prefix.size(), m_prefix ) ) )
+				return false;
+
+			if( m_dfa &&
+					lazy_dfa_t::result_t::no_match == m_dfa->run( text, nullptr ) )
+				return false;
+
+			thread_local vm_state_t state;
+
+			const auto slots_count = m_captures_count * 2u;
+			if( !run( state, 0u, text, 0u, !m_anchored, slots_count ) )
+				return false;
+
+			results.clear();
+			results.reserve( m_captures_count );
+			for( std::size_t i = 0u; i != slots_count; i += 2u )
+			{
+				const auto begin = state.m_result[ i ];
+				const auto end = state.m_result[ i + 1u ];
+				if( unset_slot == begin || unset_slot == end )
+					results.emplace_back( 0u, 0u );
+				else
+					results.emplace_back( begin, end );
+			}
+
+			return true;
+		}
+
+		//! Count of capture groups (including the whole match).
+		[[nodiscard]]
+		std::size_t
+		captures_count() const noexcept { return m_captures_count; }
+
+	private:
+		//! A list of threads of VM.
+		/*!
+		 * It's a sparse set of program counters, so a check for
+		 * a presence of a thread is O(1).
+		 */
+		struct thread_list_t
+		{
+			std::vector< std::uint32_t > m_sparse;
+			std::vector< std::uint32_t > m_dense;
+			//! Capture slots for every item of m_dense.
+			std::vector< std::size_t > m_slots;
+			std::size_t m_size{ 0u };
+
+			void
+			prepare( std::size_t program_size, std::size_t slots_count )
+			{
+				if( m_sparse.size() < program_size )
+				{
+					m_sparse.resize( program_size );
+					m_dense.resize( program_size );
+				}
+				if( m_slots.size() < program_size * slots_count )
+					m_slots.resize( program_size * slots_count );
+				m_size = 0u;
+			}
+
+			[[nodiscard]]
+			bool
+			contains( std::uint32_t pc ) const noexcept
+			{
+				const auto i = m_sparse[ pc ];
+				return i < m_size && m_dense[ i ] == pc;
+			}
+
+			std::size_t
+			insert( std::uint32_t pc ) noexcept
+			{
+				m_sparse[ pc ] = static_cast< std::uint32_t >( m_size );
+				m_dense[ m_size ] = pc;
+				return m_size++;
+			}
+		};
+
+		//! Data for the following of epsilon-transitions.
+		struct stack_item_t
+		{
+			std::uint32_t m_pc;
+			//! Should a capture slot be restored instead of following m_pc?
+			bool m_restore;
+			std::uint32_t m_slot;
+			std::size_t m_value;
+		};
+
+		//! State of a VM.
+		/*!
+		 * An object is reused between matches to avoid memory allocations.
+		 */
+		struct vm_state_t
+		{
+			thread_list_t m_current;
+			thread_list_t m_next;
+			std::vector< stack_item_t > m_stack;
+			std::vector< std::size_t > m_slots;
+			std::vector< std::size_t > m_result;
+		};
+
+		std::vector< instruction_t > m_code;
+		std::vector< char_set_t > m_char_sets;
+		std::size_t m_captures_count{ 0u };
+
+		//! Does the regex start with `^`?
+		bool m_anchored{ false };
+		//! A literal text that follows `^`.
+		std::string m_prefix;
+
+		//! A DFA for fast rejection of non-matching texts (can be nullptr).
+		/*!
+		 * The DFA is immutable from the logical point of view,
+		 * so it can be shared between copies of a regex.
+		 */
+		std::shared_ptr< lazy_dfa_t > m_dfa;
+
+		void
+		detect_literal_prefix( const node_t & root )
+		{
+			const node_t * first = &root;
+			std::size_t count = 1u;
+			if( node_type_t::concatenation == root.m_type )
+			{
+				first = root.m_children.data();
+				count = root.m_children.size();
+			}
+
+			if( 0u == count || node_type_t::begin_of_input != first->m_type )
+				return;
+
+			m_anchored = true;
+			for( std::size_t i = 1u;
+				i != count && node_type_t::character == first[ i ].m_type;
+				++i )
+			{
+				m_prefix += first[ i ].m_char;
+			}
+		}
+
+		[[nodiscard]]
+		bool
+		check_assertion(
+			std::uint32_t pc,
+			string_view_t text,
+			std::size_t pos ) const
+		{
+			const auto & instruction = m_code[ pc ];
+			switch( instruction.m_opcode )
+			{
+				case opcode_t::begin_of_input:
+					return 0u == pos;
+
+				case opcode_t::end_of_input:
+					return text.size() == pos;
+
+				case opcode_t::word_boundary:
+				case opcode_t::not_word_boundary:
+				{
+					const bool before = 0u != pos && is_word_char( text[ pos - 1u ] );
+					const bool after = pos != text.size() && is_word_char( text[ pos ] );
+					return ( before != after ) ==
+						( opcode_t::word_boundary == instruction.m_opcode );
+				}
+
+				case opcode_t::lookahead:
+				case opcode_t::negative_lookahead:
+				{
+					// Captures inside lookaheads aren't reported.
+					vm_state_t state;
+					return run( state, instruction.m_x, text, pos, false, 0u ) ==
+						( opcode_t::lookahead == instruction.m_opcode );
+				}
+
+				default:
+					return true;
+			}
+		}
+
+		//! Add a thread and all threads reachable by epsilon-transitions.
+		/*!
+		 * Threads are added in order of their priorities.
+		 * Slots from @a state.m_slots are used (they are modified by `save`
+		 * instructions and then restored).
+		 */
+		void
+		add_thread(
+			vm_state_t & state,
+			thread_list_t & list,
+			std::uint32_t start_pc,
+			string_view_t text,
+			std::size_t pos,
+			std::size_t slots_count ) const
+		{
+			auto & stack = state.m_stack;
+			stack.clear();
+			stack.push_back( stack_item_t{ start_pc, false, 0u, 0u } );
+
+			while( !stack.empty() )
+			{
+				const auto item = stack.back();
+				stack.pop_back();
+
+				if( item.m_restore )
+				{
+					state.m_slots[ item.m_slot ] = item.m_value;
+					continue;
+				}
+
+				const auto pc = item.m_pc;
+				if( list.contains( pc ) )
+					continue;
+				const auto index = list.insert( pc );
+
+				const auto & instruction = m_code[ pc ];
+				switch( instruction.m_opcode )
+				{
+					case opcode_t::jump:
+						stack.push_back( stack_item_t{ instruction.m_x, false, 0u, 0u } );
+					break;
+
+					case opcode_t::split:
+						// The item pushed last is handled first.
+						stack.push_back( stack_item_t{ instruction.m_y, false, 0u, 0u } );
+						stack.push_back( stack_item_t{ instruction.m_x, false, 0u, 0u } );
+					break;
+
+					case opcode_t::save:
+						if( instruction.m_x < slots_count )
+						{
+							stack.push_back( stack_item_t{
+									0u, true, instruction.m_x,
+									state.m_slots[ instruction.m_x ] } );
+							state.m_slots[ instruction.m_x ] = pos;
+						}
+						stack.push_back( stack_item_t{ pc + 1u, false, 0u, 0u } );
+					break;
+
+					case opcode_t::begin_of_input:
+					case opcode_t::end_of_input:
+					case opcode_t::word_boundary:
+					case opcode_t::not_word_boundary:
+					case opcode_t::lookahead:
+					case opcode_t::negative_lookahead:
+						if( check_assertion( pc, text, pos ) )
+							stack.push_back( stack_item_t{ pc + 1u, false, 0u, 0u } );
+					break;
+
+					case opcode_t::character:
+					case opcode_t::char_set:
+					case opcode_t::match:
+						std::copy(
+								state.m_slots.begin(),
+								state.m_slots.begin() + static_cast< std::ptrdiff_t >( slots_count ),
+								list.m_slots.begin() +
+									static_cast< std::ptrdiff_t >( index * slots_count ) );
+					break;
+				}
+			}
+		}
+
+		//! Run the VM.
+		/*!
+		 * @param search Can a match start at any position after @a start_pos?
+		 * @param slots_count Count of capture slots (0 if captures
+		 * aren't necessary, then the first found match is taken).
+		 *
+		 * @return true if there is a match. Its slots are stored to
+		 * @a state.m_result.
+		 */
+		[[nodiscard]]
+		bool
+		run(
+			vm_state_t & state,
+			std::uint32_t start_pc,
+			string_view_t text,
+			std::size_t start_pos,
+			bool search,
+			std::size_t slots_count ) const
+		{
+			state.m_current.prepare( m_code.size(), slots_count );
+			state.m_next.prepare( m_code.size(), slots_count );
+			state.m_slots.assign( slots_count, unset_slot );
+			state.m_result.assign( slots_count, unset_slot );
+
+			auto * current = &state.m_current;
+			auto * next = &state.m_next;
+
+			bool matched = false;
+			for( std::size_t pos = start_pos;; ++pos )
+			{
+				// A new thread has the lowest priority.
+				if( !matched && ( start_pos == pos || search ) )
+				{
+					std::fill( state.m_slots.begin(), state.m_slots.end(), unset_slot );
+					add_thread( state, *current, start_pc, text, pos, slots_count );
+				}
+
+				if( 0u == current->m_size )
+					break;
+
+				next->m_size = 0u;
+				for( std::size_t i = 0u; i != current->m_size; ++i )
+				{
+					const auto pc = current->m_dense[ i ];
+					const auto & instruction = m_code[ pc ];
+					const auto slots_offset =
+						static_cast< std::ptrdiff_t >( i * slots_count );
+
+					bool consumed = false;
+					if( opcode_t::character == instruction.m_opcode )
+						consumed = pos != text.size() && text[ pos ] == instruction.m_char;
+					else if( opcode_t::char_set == instruction.m_opcode )
+						consumed = pos != text.size() &&
+							m_char_sets[ instruction.m_x ].test( to_uchar( text[ pos ] ) );
+					else if( opcode_t::match == instruction.m_opcode )
+					{
+						matched = true;
+						if( 0u == slots_count )
+							return true;
+
+						std::copy(
+								current->m_slots.begin() + slots_offset,
+								current->m_slots.begin() + slots_offset +
+									static_cast< std::ptrdiff_t >( slots_count ),
+								state.m_result.begin() );
+
+						// Threads with lower priorities are discarded.
+						break;
+					}
+
+					if( consumed )
+					{
+						std::copy(
+								current->m_slots.begin() + slots_offset,
+								current->m_slots.begin() + slots_offset +
+									static_cast< std::ptrdiff_t >( slots_count ),
+								state.m_slots.begin() );
+						add_thread( state, *next, pc + 1u, text, pos + 1u, slots_count );
+					}
+				}
+
+				if( text.size() == pos )
+					break;
+
+				std::swap( current, next );
+			}
+
+			return matched;
+		}
+};
+
+//
+// regex_set_t
+//
+
+//! A set of regexes that are checked by a single pass over a text.
+/*!
+ * Programs of all regexes are merged into one program with several
+ * entry points, and the id of a `match` instruction is the index of
+ * a regex. A lazy DFA for the merged program finds all regexes that
+ * match a text in one pass, so the cost doesn't depend on the count
+ * of regexes.
+ *
+ * Regexes that can't be handled by a DFA (with `\b`, `\B` or
+ * lookaheads) are always reported as candidates.
+ *
+ * The DFA is created on the first call to match() after the addition
+ * of regexes. If the limit of states of the DFA is reached match()
+ * returns false for every text that needs a new state (see lazy_dfa_t).
+ *
+ * Calls to match() are thread-safe, but add() must not be called in
+ * parallel with match().
+ */
+class regex_set_t
+{
+	public:
+		//! Indexes of regexes in ascending order.
+		using indexes_container_t =
+			restinio::utils::small_vector_t< std::uint32_t, 16u >;
+
+		//! Default limit of states of the DFA.
+		static constexpr std::size_t default_max_states = 16u * 1024u;
+
+		explicit regex_set_t( std::size_t max_states = default_max_states )
+			:	m_max_states{ max_states }
+		{}
+
+		regex_set_t( const regex_set_t & ) = delete;
+		regex_set_t & operator=( const regex_set_t & ) = delete;
+
+		//! Add a regex.
+		/*!
+		 * The index of the regex is the count of regexes added before.
+		 */
+		void
+		add( const regex_t & regex )
+		{
+			const auto index = static_cast< std::uint32_t >( m_regexes_count++ );
+
+			if( regex.m_code.empty() )
+				return;
+
+			if( !lazy_dfa_t::is_applicable( regex.m_code ) )
+			{
+				m_always_checked.push_back( index );
+				return;
+			}
+
+			const auto code_offset = static_cast< std::uint32_t >( m_code.size() );
+			const auto sets_offset = static_cast< std::uint32_t >( m_char_sets.size() );
+			if( std::numeric_limits< std::uint32_t >::max() - m_code.size() <
+					regex.m_code.size() )
+				throw exception_t{ "regex set is too big" };
+
+			m_starts.push_back( lazy_dfa_t::start_t{ code_offset, !regex.m_anchored } );
+			for( auto instruction : regex.m_code )
+			{
+				switch( instruction.m_opcode )
+				{
+					case opcode_t::jump:
+						instruction.m_x += code_offset;
+					break;
+
+					case opcode_t::split:
+						instruction.m_x += code_offset;
+						instruction.m_y += code_offset;
+					break;
+
+					case opcode_t::char_set:
+						instruction.m_x += sets_offset;
+					break;
+
+					case opcode_t::match:
+						instruction.m_x = index;
+					break;
+
+					default:
+						break;
+				}
+
+				m_code.push_back( instruction );
+			}
+
+			m_char_sets.insert( m_char_sets.end(),
+					regex.m_char_sets.begin(), regex.m_char_sets.end() );
+
+			// The DFA has to be recreated.
+			m_dfa.reset();
+			m_dfa_ptr.store( nullptr, std::memory_order_relaxed );
+		}
+
+		//! Count of added regexes.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept { return m_regexes_count; }
+
+		//! Find regexes that match @a text.
+		/*!
+		 * @return false if the result is unknown (the limit of states
+		 * of the DFA is reached). Otherwise @a indexes contains indexes
+		 * of regexes that match @a text (and of regexes that can't be
+		 * handled by the DFA).
+		 */
+		[[nodiscard]]
+		bool
+		match( string_view_t text, indexes_container_t & indexes ) const
+		{
+			lazy_dfa_t::ids_container_t ids;
+			if( const auto * dfa = get_dfa() )
+			{
+				if( lazy_dfa_t::result_t::unknown == dfa->run( text, &ids ) )
+					return false;
+			}
+
+			ids.insert( ids.end(), m_always_checked.begin(), m_always_checked.end() );
+			std::sort( ids.begin(), ids.end() );
+
+			indexes.clear();
+			for( std::size_t i = 0u; i != ids.size(); ++i )
+				if( 0u == i || ids[ i ] != ids[ i - 1u ] )
+					indexes.push_back( ids[ i ] );
+
+			return true;
+		}
+
+	private:
+		const std::size_t m_max_states;
+
+		std::size_t m_regexes_count{ 0u };
+
+		//! The merged program.
+		std::vector< instruction_t > m_code;
+		std::vector< char_set_t > m_char_sets;
+		std::vector< lazy_dfa_t::start_t > m_starts;
+
+		//! Indexes of regexes that can't be handled by the DFA.
+		std::vector< std::uint32_t > m_always_checked;
+
+		mutable std::mutex m_lock;
+		mutable std::unique_ptr< lazy_dfa_t > m_dfa;
+		//! A pointer to m_dfa for reading without the lock.
+		mutable std::atomic< const lazy_dfa_t * > m_dfa_ptr{ nullptr };
+
+		[[nodiscard]]
+		const lazy_dfa_t *
+		get_dfa() const
+		{
+			if( m_starts.empty() )
+				return nullptr;
+
+			if( const auto * dfa = m_dfa_ptr.load( std::memory_order_acquire ) )
+				return dfa;
+
+			std::lock_guard< std::mutex > lock{ m_lock };
+			if( !m_dfa )
+			{
+				m_dfa = std::make_unique< lazy_dfa_t >(
+						m_code, m_char_sets, m_starts, m_max_states );
+				m_dfa_ptr.store( m_dfa.get(), std::memory_order_release );
+			}
+
+			return m_dfa.get();
+		}
+};
+
+} /* namespace nfa_regex */
+
+} /* namespace impl */
+
+} /* namespace router */
+
+} /* namespace restinio */
@@ -47,6 +47,14 @@ class target_path_holder_t
 	public:
 		using data_t = std::unique_ptr<char[]>;
 
+		/*!
+		 * @brief Type of a pointer to an object that owns the original
+		 * value of target_path.
+		 *
+		 * @since v.0.7.10
+		 */
+		using owner_t = std::shared_ptr<const void>;
+
 		//! Initializing constructor.
 		/*!
 		 * Copies the value of @a original_path into a unique and 
@@ -60,10 +68,35 @@ class target_path_holder_t
 		 * @a original_path has an invalid format.
 		 */
 		target_path_holder_t( string_view_t original_path )
+			:	target_path_holder_t{ original_path, owner_t{} }
+		{}
+
+		//! Initializing constructor that avoids copying if possible.
+		/*!
+		 * If @a owner isn't empty and the normalization isn't needed
+		 * then the value of @a original_path isn't copied. The holder
+		 * refers to the original value and keeps @a owner instead.
+		 *
+		 * @attention
+		 * @a owner must own the data of @a original_path (usually it's
+		 * the request object).
+		 *
+		 * @since v.0.7.10
+		 */
+		target_path_holder_t( string_view_t original_path, owner_t owner )
 			:	m_size{ restinio::utils::uri_normalization::
 					unreserved_chars::estimate_required_capacity( original_path ) }
 		{
+			if( m_size == original_path.size() && owner )
+			{
+				// The original value can be used as is.
+				m_owner = std::move( owner );
+				m_view_data = original_path.data();
+				return;
+			}
+
 			m_data.reset( new char[ m_size ] );
+			m_view_data = m_data.get();
 
 			if( m_size != original_path.size() )
 				// Transformation is actually needed.
@@ -85,7 +118,7 @@ class target_path_holder_t
 		string_view_t
 		view() const noexcept
 		{
-			return { m_data.get(), m_size };
+			return { m_view_data, m_size };
 		}
 
 		//! Give out the value from holder.
@@ -93,6 +126,11 @@ class target_path_holder_t
 		 * @attention
 		 * The holder becomes empty after the return from that method and
 		 * should not be used anymore.
+		 *
+		 * @note
+		 * Since v.0.7.10 the returned value is empty if the holder refers
+		 * to the original value. giveout_owner() should be used in that
+		 * case too.
 		 */
 		[[nodiscard]]
 		data_t
@@ -101,6 +139,19 @@ class target_path_holder_t
 			return std::move(m_data);
 		}
 
+		//! Give out the owner of the original value.
+		/*!
+		 * It's empty if the value was copied.
+		 *
+		 * @since v.0.7.10
+		 */
+		[[nodiscard]]
+		owner_t
+		giveout_owner() noexcept
+		{
+			return std::move(m_owner);
+		}
+
 	private:
 		//! Actual data with target_path.
 		/*!
@@ -108,6 +159,21 @@ class target_path_holder_t
 		 * It becomes empty after a call to giveout_data().
 		 */
 		data_t m_data;
+
+		/*!
+		 * @brief The owner of the original value if it isn't copied.
+		 *
+		 * @since v.0.7.10
+		 */
+		owner_t m_owner;
+
+		/*!
+		 * @brief Pointer to the value (to m_data or to the original one).
+		 *
+		 * @since v.0.7.10
+		 */
+		const char * m_view_data{ nullptr };
+
 		//! The length of target_path.
 		std::size_t m_size;
 };
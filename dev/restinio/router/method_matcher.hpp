@@ -14,6 +14,7 @@
 #include <restinio/http_headers.hpp>
 
 #include <initializer_list>
+#include <optional>
 #include <vector>
 
 namespace restinio
@@ -56,6 +57,27 @@ struct method_matcher_t
 	[[nodiscard]]
 	virtual bool
 	match( const http_method_id_t & method ) const noexcept = 0;
+
+	//! Get the list of all methods that can be applied to a route.
+	/*!
+	 * Routers use this list for grouping routes by HTTP method, so
+	 * match() isn't called for a request with a method from the list.
+	 *
+	 * Returns an empty optional if the list can't be provided (e.g.
+	 * if every method except some can be applied). It's the default.
+	 *
+	 * @attention
+	 * If a derived class overrides match() it has to override this
+	 * method too.
+	 *
+	 * @since v.0.7.10
+	 */
+	[[nodiscard]]
+	virtual std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const
+	{
+		return std::nullopt;
+	}
 };
 
 namespace impl
@@ -93,6 +115,13 @@ public :
 	{
 		return m_matcher->match( method );
 	}
+
+	[[nodiscard]]
+	std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const override
+	{
+		return m_matcher->accepted_methods();
+	}
 };
 
 //
@@ -122,6 +151,13 @@ public :
 	{
 		return m_method == method;
 	}
+
+	[[nodiscard]]
+	std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const override
+	{
+		return std::vector< http_method_id_t >{ m_method };
+	}
 };
 
 //
@@ -166,6 +202,13 @@ public :
 
 		return false;
 	}
+
+	[[nodiscard]]
+	std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const override
+	{
+		return std::vector< http_method_id_t >{ m_methods.begin(), m_methods.end() };
+	}
 };
 
 //
@@ -194,6 +237,13 @@ public :
 	{
 		return !base_type_t::match( method );
 	}
+
+	[[nodiscard]]
+	std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const override
+	{
+		return std::nullopt;
+	}
 };
 
 //
@@ -490,6 +540,13 @@ public:
 		return false;
 	}
 
+	[[nodiscard]]
+	std::optional< std::vector< http_method_id_t > >
+	accepted_methods() const override
+	{
+		return m_methods;
+	}
+
 	dynamic_any_of_methods_matcher_t &
 	add( http_method_id_t method )
 	{
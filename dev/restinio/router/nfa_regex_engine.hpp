@@ -0,0 +1,99 @@
+/*
+	restinio
+*/
+
+/*!
+	Regex engine that doesn't depend on external libraries.
+
+	@since v.0.7.10
+*/
+
+#pragma once
+
+#include <restinio/router/impl/nfa_regex.hpp>
+
+namespace restinio
+{
+
+namespace router
+{
+
+//
+// nfa_regex_engine_t
+//
+
+//! Regex engine implementation that doesn't depend on external libraries.
+/*!
+ * Regexes are compiled into programs for a simulation of NFA. Matching
+ * time is linear in the length of a request target (there is no
+ * backtracking), and in typical cases a route is rejected by a check
+ * of its literal prefix.
+ *
+ * Only a subset of ECMAScript regex syntax is supported (everything
+ * that path2regex produces and typical patterns for parameters):
+ * literals, escapes, `.`, char classes, `\d \w \s \D \W \S`, groups
+ * (capturing, non-capturing, `(?=...)` and `(?!...)`), alternations,
+ * greedy and lazy quantifiers (including `{n,m}`), `^`, `$`, `\b`
+ * and `\B`. An exception is thrown for a regex with backreferences
+ * or lookbehinds.
+ *
+ * Usage:
+ * @code
+ * using router_t = restinio::router::express_router_t<
+ * 		restinio::router::nfa_regex_engine_t >;
+ * @endcode
+ *
+ * @since v.0.7.10
+ */
+struct nfa_regex_engine_t
+{
+	using compiled_regex_t = impl::nfa_regex::regex_t;
+	using match_results_t = impl::nfa_regex::match_results_t;
+	using matched_item_descriptor_t = match_results_t::value_type;
+
+	static constexpr std::size_t
+	max_capture_groups()
+	{
+		// Captures are stored in dynamic buffers, so no limits beforehand.
+		return std::numeric_limits< std::size_t >::max();
+	}
+
+	//! Create compiled regex object for a given route.
+	static auto
+	compile_regex(
+		//! Regular expression (the pattern).
+		string_view_t r,
+		//! Option for case sensativity.
+		bool is_case_sensative )
+	{
+		return compiled_regex_t{ r, !is_case_sensative };
+	}
+
+	//! Wrapper function for matching logic invokation.
+	static auto
+	try_match(
+		string_view_t target_path,
+		const compiled_regex_t & r,
+		match_results_t & match_results )
+	{
+		return r.search( target_path, match_results );
+	}
+
+	//! Get the beginning of a submatch.
+	static auto
+	submatch_begin_pos( const matched_item_descriptor_t & m )
+	{
+		return m.first;
+	}
+
+	//! Get the end of a submatch.
+	static auto
+	submatch_end_pos( const matched_item_descriptor_t & m )
+	{
+		return m.second;
+	}
+};
+
+} /* namespace router */
+
+} /* namespace restinio */
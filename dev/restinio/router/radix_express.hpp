@@ -0,0 +1,696 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Express.js style router based on a prefix tree.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/router/express.hpp>
+
+#include <restinio/utils/small_vector.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace restinio
+{
+
+namespace router
+{
+
+namespace impl
+{
+
+namespace radix_express
+{
+
+//! Lowercase ASCII letter.
+[[nodiscard]]
+inline char
+ascii_tolower( char c ) noexcept
+{
+	return ( 'A' <= c && c <= 'Z' ) ? static_cast< char >( c - 'A' + 'a' ) : c;
+}
+
+[[nodiscard]]
+inline bool
+is_ascii( char c ) noexcept
+{
+	return 0 == ( static_cast< unsigned char >( c ) & 0x80u );
+}
+
+using token_descriptions_t = std::vector< path2regex::impl::token_description_t >;
+
+//
+// make_route_prefix()
+//
+/*!
+ * @brief Get the literal text every path matching the route starts with.
+ *
+ * The result is in lowercase because it's used only for the selection
+ * of candidate routes.
+ */
+[[nodiscard]]
+inline std::string
+make_route_prefix(
+	const token_descriptions_t & tokens,
+	const path2regex::options_t & options )
+{
+	std::string result;
+	for( const auto & t : tokens )
+	{
+		if( path2regex::impl::token_type_t::plain_string == t.m_type )
+			result += t.m_text;
+		else
+		{
+			// The prefix of a parameter is mandatory only if
+			// the parameter isn't optional or is partial.
+			if( !t.m_optional || t.m_partial )
+				result += t.m_text;
+			break;
+		}
+	}
+
+	// Case-insensitive comparison of non-ASCII chars depends on
+	// a regex engine, so the prefix is cut.
+	if( !options.sensitive() )
+		result.erase(
+				std::find_if_not( result.begin(), result.end(), is_ascii ),
+				result.end() );
+
+	std::transform( result.begin(), result.end(), result.begin(), ascii_tolower );
+
+	return result;
+}
+
+//
+// simple_route_matcher_t
+//
+/*!
+ * @brief A matcher for routes that can be matched without regex.
+ *
+ * A route is simple if all its parameters are mandatory, have the default
+ * pattern, and every parameter is followed by '/' or by the end of
+ * the route. The value of such a parameter is the whole path segment.
+ * For example: `/api/v1/users/:id/posts/:post_id`.
+ */
+class simple_route_matcher_t
+{
+	public:
+		//! Make a matcher if the route is simple.
+		[[nodiscard]]
+		static std::optional< simple_route_matcher_t >
+		try_make(
+			const token_descriptions_t & tokens,
+			const path2regex::options_t & options )
+		{
+			if( !options.ending() || "$" != options.make_ends_with() ||
+					"/" != options.delimiter() )
+				return std::nullopt;
+
+			simple_route_matcher_t result{ options };
+			result.m_literals.emplace_back();
+
+			for( const auto & t : tokens )
+			{
+				if( path2regex::impl::token_type_t::capturing_token == t.m_type )
+				{
+					if( t.m_optional || t.m_repeat || t.m_partial ||
+							!t.m_default_pattern || "/" != t.m_delimiter )
+						return std::nullopt;
+
+					result.m_literals.back() += t.m_text;
+					result.m_literals.emplace_back();
+				}
+				else
+					result.m_literals.back() += t.m_text;
+			}
+
+			// A parameter must be followed by '/' or by the end of the route.
+			for( std::size_t i = 1u; i < result.m_literals.size(); ++i )
+			{
+				const auto & l = result.m_literals[ i ];
+				if( l.empty() ? i + 1u != result.m_literals.size() : '/' != l.front() )
+					return std::nullopt;
+			}
+
+			if( !result.m_sensitive )
+			{
+				for( auto & l : result.m_literals )
+				{
+					if( !std::all_of( l.begin(), l.end(), is_ascii ) )
+						return std::nullopt;
+					std::transform( l.begin(), l.end(), l.begin(), ascii_tolower );
+				}
+			}
+
+			return result;
+		}
+
+		//! Try to match the path and init route params.
+		template< typename Route_Matcher >
+		[[nodiscard]]
+		bool
+		match(
+			target_path_holder_t & target_path,
+			const Route_Matcher & route_matcher,
+			route_params_t & parameters ) const
+		{
+			const auto path = target_path.view();
+
+			utils::small_vector_t< string_view_t, 8u > values;
+			std::size_t pos = 0u;
+			for( std::size_t i = 0u; i != m_literals.size(); ++i )
+			{
+				if( !match_literal( path, pos, m_literals[ i ] ) )
+					return false;
+				pos += m_literals[ i ].size();
+
+				if( i + 1u != m_literals.size() )
+				{
+					// A parameter takes the whole segment.
+					auto end = path.find( '/', pos );
+					if( string_view_t::npos == end )
+						end = path.size();
+					if( end == pos )
+						return false;
+
+					values.push_back( path.substr( pos, end - pos ) );
+					pos = end;
+				}
+			}
+
+			const auto rest = path.substr( pos );
+			if( !rest.empty() && ( m_strict || "/" != rest ) )
+				return false;
+
+			route_matcher.set_route_params(
+					target_path,
+					path,
+					values.data(),
+					values.size(),
+					parameters );
+
+			return true;
+		}
+
+	private:
+		explicit simple_route_matcher_t( const path2regex::options_t & options )
+			:	m_sensitive{ options.sensitive() }
+			,	m_strict{ options.strict() }
+		{}
+
+		[[nodiscard]]
+		bool
+		match_literal(
+			string_view_t path,
+			std::size_t pos,
+			const std::string & literal ) const noexcept
+		{
+			if( path.size() - pos < literal.size() )
+				return false;
+
+			if( m_sensitive )
+				return 0 == path.compare( pos, literal.size(), literal );
+
+			for( std::size_t i = 0u; i != literal.size(); ++i )
+				if( ascii_tolower( path[ pos + i ] ) != literal[ i ] )
+					return false;
+
+			return true;
+		}
+
+		//! Literals between parameters.
+		/*!
+		 * There is a parameter between every two literals.
+		 */
+		std::vector< std::string > m_literals;
+
+		bool m_sensitive;
+		bool m_strict;
+};
+
+//
+// route_prefix_tree_t
+//
+/*!
+ * @brief A compressed prefix tree of literal prefixes of routes.
+ *
+ * Every node holds indexes of routes which prefix ends at the node.
+ * All routes that can match a path are found by a single walk from
+ * the root along the path.
+ */
+class route_prefix_tree_t
+{
+	public:
+		//! A container for indexes of candidate routes.
+		using candidates_t = utils::small_vector_t< std::size_t, 16u >;
+
+		//! Add a route with the lowercased prefix @a key.
+		void
+		insert( string_view_t key, std::size_t route_index )
+		{
+			node_t * node = &m_root;
+			while( !key.empty() )
+			{
+				auto it = find_child( *node, key.front() );
+				if( node->m_children.end() == it )
+				{
+					auto child = std::make_unique< node_t >();
+					child->m_label.assign( key.data(), key.size() );
+					child->m_routes.push_back( route_index );
+					node->m_children.push_back( std::move( child ) );
+					return;
+				}
+
+				auto & label = (*it)->m_label;
+				const auto common = static_cast< std::size_t >(
+					std::mismatch(
+						label.begin(), label.end(),
+						key.begin(), key.end() ).first - label.begin() );
+
+				if( common < label.size() )
+				{
+					// The node has to be split.
+					auto middle = std::make_unique< node_t >();
+					middle->m_label = label.substr( 0u, common );
+					label.erase( 0u, common );
+					middle->m_children.push_back( std::move( *it ) );
+					*it = std::move( middle );
+				}
+
+				node = it->get();
+				key.remove_prefix( common );
+			}
+
+			node->m_routes.push_back( route_index );
+		}
+
+		//! Get indexes of routes which prefixes match @a path.
+		/*!
+		 * Indexes are sorted in ascending order.
+		 */
+		void
+		collect( string_view_t path, candidates_t & candidates ) const
+		{
+			const node_t * node = &m_root;
+			std::size_t pos = 0u;
+			for(;;)
+			{
+				for( const auto i : node->m_routes )
+					candidates.push_back( i );
+
+				if( pos == path.size() )
+					break;
+
+				const auto it = find_child( *node, ascii_tolower( path[ pos ] ) );
+				if( node->m_children.end() == it )
+					break;
+
+				const auto & label = (*it)->m_label;
+				if( path.size() - pos < label.size() ||
+						!std::equal( label.begin(), label.end(),
+							path.begin() + static_cast< std::ptrdiff_t >( pos ),
+							[]( char l, char p ) { return l == ascii_tolower( p ); } ) )
+					break;
+
+				pos += label.size();
+				node = it->get();
+			}
+
+			std::sort( candidates.begin(), candidates.end() );
+		}
+
+	private:
+		struct node_t
+		{
+			//! Lowercased part of a prefix.
+			std::string m_label;
+
+			std::vector< std::unique_ptr< node_t > > m_children;
+
+			//! Indexes of routes which prefixes end here.
+			std::vector< std::size_t > m_routes;
+		};
+
+		using children_t = std::vector< std::unique_ptr< node_t > >;
+
+		[[nodiscard]]
+		static children_t::iterator
+		find_child( node_t & node, char first ) noexcept
+		{
+			return std::find_if(
+					node.m_children.begin(),
+					node.m_children.end(),
+					[first]( const auto & child ) {
+						return first == child->m_label.front();
+					} );
+		}
+
+		[[nodiscard]]
+		static children_t::const_iterator
+		find_child( const node_t & node, char first ) noexcept
+		{
+			return std::find_if(
+					node.m_children.begin(),
+					node.m_children.end(),
+					[first]( const auto & child ) {
+						return first == child->m_label.front();
+					} );
+		}
+
+		node_t m_root;
+};
+
+} /* namespace radix_express */
+
+} /* namespace impl */
+
+//
+// generic_radix_express_router_t
+//
+
+//! Express.js style router that doesn't try every route.
+/*!
+	This router accepts the same routes as generic_express_router_t and
+	gives the same results (including route_params_t values), but it
+	doesn't apply regexes of all routes to a request target one by one.
+
+	Literal prefixes of routes (the text before the first parameter)
+	are stored in a compressed prefix tree. Only routes which prefixes
+	are found during a single walk along the request target are checked.
+	Routes that have only plain text and parameters with the default
+	pattern taking a whole path segment (like `/users/:id/posts`) are
+	matched without regex. Regex is used only for routes with custom
+	patterns, optional or repeated parameters, or non-default options.
+
+	If several routes match a request the route added first is used
+	(as in generic_express_router_t).
+
+	@tparam Regex_Engine Type of regex-engine to be used.
+
+	@tparam Extra_Data_Factory Type of extra-data-factory specified in
+	server's traits.
+
+	@since v.0.7.10
+*/
+template<
+	typename Regex_Engine,
+	typename Extra_Data_Factory >
+class generic_radix_express_router_t
+{
+	public:
+		using actual_request_handle_t =
+				generic_request_handle_t< typename Extra_Data_Factory::data_t >;
+		using actual_request_handler_t =
+				generic_express_request_handler_t<
+						typename Extra_Data_Factory::data_t >;
+		using non_matched_handler_t =
+				generic_non_matched_request_handler_t<
+						typename Extra_Data_Factory::data_t
+				>;
+
+		generic_radix_express_router_t() = default;
+		generic_radix_express_router_t( generic_radix_express_router_t && ) = default;
+
+		[[nodiscard]]
+		request_handling_status_t
+		operator()( actual_request_handle_t req ) const
+		{
+			// The request target isn't copied if it's possible.
+			impl::target_path_holder_t target_path{ req->header().path(), req };
+
+			candidates_t candidates;
+			m_prefix_tree.collect( target_path.view(), candidates );
+
+			route_params_t params;
+			for( const auto i : candidates )
+			{
+				const auto & route = m_routes[ i ];
+				if( route.match( req->header(), target_path, params ) )
+				{
+					return route.m_handler( std::move( req ), std::move( params ) );
+				}
+			}
+
+			// Here: none of the routes matches this handler.
+
+			if( m_non_matched_request_handler )
+			{
+				return m_non_matched_request_handler( std::move( req ) );
+			}
+
+			return request_not_handled();
+		}
+
+		//! Add handlers.
+		//! \{
+		template< typename Method_Matcher >
+		void
+		add_handler(
+			Method_Matcher && method_matcher,
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				std::forward<Method_Matcher>(method_matcher),
+				route_path,
+				path2regex::options_t{},
+				std::move( handler ) );
+		}
+
+		template< typename Method_Matcher >
+		void
+		add_handler(
+			Method_Matcher && method_matcher,
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			using namespace impl::radix_express;
+
+			const auto tokens =
+				path2regex::impl::parse< impl::route_params_appender_t >(
+						route_path, options );
+			auto matcher_data = path2regex::impl::tokens2regexp<
+					impl::route_params_appender_t,
+					Regex_Engine >( route_path, tokens, options );
+
+			token_descriptions_t descriptions;
+			descriptions.reserve( tokens.size() );
+			for( const auto & t : tokens )
+				descriptions.push_back( t->describe() );
+
+			const auto prefix = make_route_prefix( descriptions, options );
+
+			m_routes.push_back( route_t{
+					route_matcher_t{
+						std::forward<Method_Matcher>(method_matcher),
+						std::move( matcher_data.m_regex ),
+						std::move( matcher_data.m_named_params_buffer ),
+						std::move( matcher_data.m_param_appender_sequence ) },
+					simple_route_matcher_t::try_make( descriptions, options ),
+					std::move( handler ) } );
+
+			m_prefix_tree.insert( prefix, m_routes.size() - 1u );
+		}
+
+		void
+		http_delete(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_delete(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_delete(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_delete(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_get(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_get(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_get(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_get(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_head(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_head(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_head(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_head(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_post(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_post(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_post(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_post(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_put(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_put(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_put(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_put(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+		//! \}
+
+		//! Set handler for requests that don't match any route.
+		void
+		non_matched_request_handler( non_matched_handler_t nmrh )
+		{
+			m_non_matched_request_handler = std::move( nmrh );
+		}
+
+	private:
+		using route_matcher_t = impl::route_matcher_t< Regex_Engine >;
+		using simple_route_matcher_t =
+				impl::radix_express::simple_route_matcher_t;
+		using candidates_t =
+				impl::radix_express::route_prefix_tree_t::candidates_t;
+
+		struct route_t
+		{
+			route_matcher_t m_matcher;
+
+			//! Matcher to be used instead of regex (if route is simple).
+			std::optional< simple_route_matcher_t > m_simple_matcher;
+
+			actual_request_handler_t m_handler;
+
+			[[nodiscard]]
+			bool
+			match(
+				const http_request_header_t & h,
+				impl::target_path_holder_t & target_path,
+				route_params_t & params ) const
+			{
+				if( !m_matcher.match_method( h.method() ) )
+					return false;
+
+				return m_simple_matcher ?
+					m_simple_matcher->match( target_path, m_matcher, params ) :
+					m_matcher.match_route( target_path, params );
+			}
+		};
+
+		//! All routes in the order of addition.
+		std::vector< route_t > m_routes;
+
+		//! Prefixes of routes.
+		impl::radix_express::route_prefix_tree_t m_prefix_tree;
+
+		//! Handler that is called for requests that don't match any route.
+		non_matched_handler_t m_non_matched_request_handler;
+};
+
+//
+// radix_express_router_t
+//
+/*!
+ * @brief A type of prefix tree based express-like router for the case
+ * when the default extra-data-factory is specified in the server's traits.
+ *
+ * @tparam Regex_Engine Type of regex-engine to be used.
+ *
+ * @since v.0.7.10
+ */
+template<
+	typename Regex_Engine = std_regex_engine_t >
+using radix_express_router_t = generic_radix_express_router_t<
+		Regex_Engine,
+		no_extra_data_factory_t >;
+
+} /* namespace router */
+
+} /* namespace restinio */
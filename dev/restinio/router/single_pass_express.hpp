@@ -0,0 +1,328 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Express.js style router that matches all routes by a single pass.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <restinio/router/express.hpp>
+#include <restinio/router/nfa_regex_engine.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace restinio
+{
+
+namespace router
+{
+
+//
+// generic_single_pass_express_router_t
+//
+
+//! Express.js style router that checks all routes by a single pass.
+/*!
+	This router accepts the same routes as generic_express_router_t and
+	gives the same results (including route_params_t values), but regexes
+	of routes aren't applied to a request target one by one.
+
+	Regexes of all routes are combined into one automaton (a lazily built
+	DFA). A single pass of the automaton over a request target finds all
+	routes which regexes match the target, so the cost of matching
+	doesn't depend on the count of routes. Then the first of those routes
+	that accepts the HTTP method is used, and only its regex is run to
+	extract values of parameters.
+
+	Regexes are handled by nfa_regex_engine_t. Routes with `\b`, `\B` or
+	lookaheads in regexes can't be handled by the automaton, such routes
+	are checked for every request.
+
+	States of the automaton are built on demand and the count of them is
+	limited (see regex_set_t::default_max_states). States aren't flushed
+	when the limit is reached. After that, targets that need only known
+	states are still handled by a single pass, and all routes are checked
+	one by one for other targets (without any locks). The limit can be
+	reached for very unusual sets of routes or by a lot of unusual
+	request targets.
+
+	If several routes match a request the route added first is used
+	(as in generic_express_router_t).
+
+	@tparam Extra_Data_Factory Type of extra-data-factory specified in
+	server's traits.
+
+	@since v.0.7.10
+*/
+template< typename Extra_Data_Factory >
+class generic_single_pass_express_router_t
+{
+	public:
+		using regex_engine_t = nfa_regex_engine_t;
+
+		using actual_request_handle_t =
+				generic_request_handle_t< typename Extra_Data_Factory::data_t >;
+		using actual_request_handler_t =
+				generic_express_request_handler_t<
+						typename Extra_Data_Factory::data_t >;
+		using non_matched_handler_t =
+				generic_non_matched_request_handler_t<
+						typename Extra_Data_Factory::data_t
+				>;
+
+		generic_single_pass_express_router_t() = default;
+		generic_single_pass_express_router_t(
+				generic_single_pass_express_router_t && ) = default;
+
+		[[nodiscard]]
+		request_handling_status_t
+		operator()( actual_request_handle_t req ) const
+		{
+			// The request target isn't copied if it's possible.
+			impl::target_path_holder_t target_path{ req->header().path(), req };
+
+			route_params_t params;
+
+			indexes_container_t candidates;
+			if( m_regex_set->match( target_path.view(), candidates ) )
+			{
+				for( const auto i : candidates )
+				{
+					const auto & entry = m_routes[ i ];
+					if( entry.match( req->header(), target_path, params ) )
+					{
+						return entry.handle( std::move( req ), std::move( params ) );
+					}
+				}
+			}
+			else
+			{
+				// The automaton can't give the result,
+				// so all routes are checked.
+				for( const auto & entry : m_routes )
+				{
+					if( entry.match( req->header(), target_path, params ) )
+					{
+						return entry.handle( std::move( req ), std::move( params ) );
+					}
+				}
+			}
+
+			// Here: none of the routes matches this handler.
+
+			if( m_non_matched_request_handler )
+			{
+				return m_non_matched_request_handler( std::move( req ) );
+			}
+
+			return request_not_handled();
+		}
+
+		//! Add handlers.
+		//! \{
+		template< typename Method_Matcher >
+		void
+		add_handler(
+			Method_Matcher && method_matcher,
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				std::forward<Method_Matcher>(method_matcher),
+				route_path,
+				path2regex::options_t{},
+				std::move( handler ) );
+		}
+
+		template< typename Method_Matcher >
+		void
+		add_handler(
+			Method_Matcher && method_matcher,
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			route_entry_t entry{
+					std::forward<Method_Matcher>(method_matcher),
+					route_path,
+					options,
+					std::move( handler ) };
+
+			m_regex_set->add( entry.route_regex() );
+			m_routes.push_back( std::move( entry ) );
+		}
+
+		void
+		http_delete(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_delete(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_delete(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_delete(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_get(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_get(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_get(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_get(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_head(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_head(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_head(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_head(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_post(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_post(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_post(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_post(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+
+		void
+		http_put(
+			string_view_t route_path,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_put(),
+				route_path,
+				std::move( handler ) );
+		}
+
+		void
+		http_put(
+			string_view_t route_path,
+			const path2regex::options_t & options,
+			actual_request_handler_t handler )
+		{
+			add_handler(
+				http_method_put(),
+				route_path,
+				options,
+				std::move( handler ) );
+		}
+		//! \}
+
+		//! Set handler for requests that don't match any route.
+		void
+		non_matched_request_handler( non_matched_handler_t nmrh )
+		{
+			m_non_matched_request_handler = std::move( nmrh );
+		}
+
+	private:
+		using route_entry_t = generic_express_route_entry_t<
+				regex_engine_t,
+				Extra_Data_Factory >;
+		using regex_set_t = impl::nfa_regex::regex_set_t;
+		using indexes_container_t = regex_set_t::indexes_container_t;
+
+		//! All routes in the order of addition.
+		std::vector< route_entry_t > m_routes;
+
+		//! Regexes of all routes.
+		/*!
+		 * The index of a regex is the index of a route in m_routes.
+		 *
+		 * @note
+		 * It's stored in the dynamic memory because regex_set_t
+		 * isn't movable.
+		 */
+		std::unique_ptr< regex_set_t > m_regex_set{
+				std::make_unique< regex_set_t >() };
+
+		//! Handler that is called for requests that don't match any route.
+		non_matched_handler_t m_non_matched_request_handler;
+};
+
+//
+// single_pass_express_router_t
+//
+/*!
+ * @brief A type of single pass express-like router for the case
+ * when the default extra-data-factory is specified in the server's traits.
+ *
+ * @since v.0.7.10
+ */
+using single_pass_express_router_t =
+		generic_single_pass_express_router_t< no_extra_data_factory_t >;
+
+} /* namespace router */
+
+} /* namespace restinio */
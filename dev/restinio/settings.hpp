@@ -15,6 +15,7 @@
 #include <restinio/traits.hpp>
 
 #include <restinio/incoming_http_msg_limits.hpp>
+#include <restinio/response_cache.hpp>
 
 #include <chrono>
 #include <variant>
@@ -723,6 +724,10 @@ class basic_server_settings_t
 		/*!
 			It limits a size of chunk that can be read from socket in a single
 			read operattion (async read).
+
+			@note
+			Since v.0.7.10 it's the maximal size of the input buffer if
+			initial_buffer_size() is set.
 		*/
 		//! {
 		Derived &
@@ -745,6 +750,325 @@ class basic_server_settings_t
 		}
 		//! }
 
+		//! Initial (and minimal) size of the input buffer of a connection.
+		/*!
+		 * If it is set then the input buffer of a connection starts with
+		 * that size and grows up to buffer_size() if the whole buffer is
+		 * filled by a read operation (a big body or a burst of pipelined
+		 * requests is being received). The buffer shrinks back if it is
+		 * underused for several consecutive reads.
+		 *
+		 * Value 0 (the default) means that the input buffer has the fixed
+		 * size buffer_size().
+		 *
+		 * Usage example:
+		 * @code
+		 * restinio::server_settings_t<> settings;
+		 * settings
+		 * 	.buffer_size( 64u * 1024u )
+		 * 	.initial_buffer_size( 512u );
+		 * @endcode
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		initial_buffer_size( std::size_t s ) &
+		{
+			m_initial_buffer_size = s;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		initial_buffer_size( std::size_t s ) &&
+		{
+			return std::move( this->initial_buffer_size( s ) );
+		}
+
+		std::size_t
+		initial_buffer_size() const
+		{
+			return m_initial_buffer_size;
+		}
+		//! }
+
+		//! Release the input buffer while a connection is idle.
+		/*!
+		 * If this mode is turned on then a connection that waits for
+		 * a new request (e.g. a keep-alive connection after a response
+		 * was sent) doesn't hold its input buffer. The buffer is released
+		 * (or returned to the connection pool, see connection_pool_capacity())
+		 * and the connection waits for the readiness of the socket. A buffer
+		 * is acquired again only when there is some data to read.
+		 *
+		 * It allows to have memory consumption proportional to the count
+		 * of active connections, not to the count of open connections.
+		 * It makes sense to use it together with connection_pool_capacity(),
+		 * otherwise a new buffer is allocated for every new request.
+		 *
+		 * @note
+		 * This mode is used only for sockets that support waiting for
+		 * readiness (like asio's TCP socket). It's ignored for TLS
+		 * connections because TLS layer can have data already read
+		 * from the socket.
+		 *
+		 * The mode is turned off by default.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		release_idle_input_buffer( bool v ) &
+		{
+			m_release_idle_input_buffer = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		release_idle_input_buffer( bool v ) &&
+		{
+			return std::move( this->release_idle_input_buffer( v ) );
+		}
+
+		[[nodiscard]]
+		bool
+		release_idle_input_buffer() const noexcept
+		{
+			return m_release_idle_input_buffer;
+		}
+		//! }
+
+		//! Try to write response data synchronously first.
+		/*!
+		 * If this mode is turned on then a connection tries to write
+		 * response data by a non-blocking `write_some()` call before
+		 * starting an asynchronous write operation. If all data is
+		 * written (it's a usual case for small responses when the
+		 * socket's send buffer has enough space) then there is no need
+		 * to wait for the completion of an async operation.
+		 * Asynchronous write is used only for the rest of data if
+		 * the socket's buffer is full or the data was written partially.
+		 *
+		 * @note
+		 * This mode is used only for plain TCP sockets. It's ignored for
+		 * TLS connections.
+		 *
+		 * The mode is turned off by default.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		try_write_first( bool v ) &
+		{
+			m_try_write_first = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		try_write_first( bool v ) &&
+		{
+			return std::move( this->try_write_first( v ) );
+		}
+
+		[[nodiscard]]
+		bool
+		try_write_first() const noexcept
+		{
+			return m_try_write_first;
+		}
+		//! }
+
+		//! Add `Date` field to every response automatically.
+		/*!
+		 * If this mode is turned on then `Date` field is added to every
+		 * response that doesn't have that field. The value of the field is
+		 * taken from a per-thread cache that is updated at most once
+		 * per second, so there is no formatting for every response.
+		 *
+		 * The mode is turned off by default.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		auto_date_field( bool v ) &
+		{
+			m_auto_date_field = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		auto_date_field( bool v ) &&
+		{
+			return std::move( this->auto_date_field( v ) );
+		}
+
+		[[nodiscard]]
+		bool
+		auto_date_field() const noexcept
+		{
+			return m_auto_date_field;
+		}
+		//! }
+
+		//! Watermarks for the amount of outgoing data queued by a connection.
+		/*!
+		 * A producer of a streamed response (e.g. a chunked one) can
+		 * check whether the connection has room for more data and can
+		 * ask to be notified when it's possible to continue (see
+		 * response_builder_t<chunked_output_t>::output_is_writable() and
+		 * response_builder_t<chunked_output_t>::when_output_writable()).
+		 *
+		 * The connection isn't writable if the amount of queued but not
+		 * yet written data reaches @a high. Waiting producers are notified
+		 * when the amount falls to @a low or below.
+		 *
+		 * Zero value of @a high means that there are no limits (it's
+		 * the default).
+		 *
+		 * @note
+		 * @a low has to be less than @a high (if @a high isn't zero).
+		 * That condition is checked at the start of a server.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		outgoing_data_watermarks( std::size_t high, std::size_t low ) &
+		{
+			m_outgoing_data_high_watermark = high;
+			m_outgoing_data_low_watermark = low;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		outgoing_data_watermarks( std::size_t high, std::size_t low ) &&
+		{
+			return std::move( this->outgoing_data_watermarks( high, low ) );
+		}
+
+		[[nodiscard]]
+		std::size_t
+		outgoing_data_high_watermark() const noexcept
+		{
+			return m_outgoing_data_high_watermark;
+		}
+
+		[[nodiscard]]
+		std::size_t
+		outgoing_data_low_watermark() const noexcept
+		{
+			return m_outgoing_data_low_watermark;
+		}
+		//! }
+
+		//! A cache of responses.
+		/*!
+		 * If a cache is set then connections look for a response in it
+		 * before calling the request handler. A found response is written
+		 * without calling the handler.
+		 *
+		 * There is no cache by default.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		response_cache( std::shared_ptr< response_cache_t > cache ) &
+		{
+			m_response_cache = std::move( cache );
+			return reference_to_derived();
+		}
+
+		Derived &&
+		response_cache( std::shared_ptr< response_cache_t > cache ) &&
+		{
+			return std::move( this->response_cache( std::move( cache ) ) );
+		}
+
+		[[nodiscard]]
+		const std::shared_ptr< response_cache_t > &
+		response_cache() const noexcept
+		{
+			return m_response_cache;
+		}
+		//! }
+
+		//! Store bodies of incoming requests as ropes.
+		/*!
+		 * If this mode is turned on then the body of an incoming request
+		 * is stored as a chain of segments (see body_rope_t) instead of
+		 * a single std::string. A body received in many pieces is
+		 * copied only once and there are no reallocations. The size of
+		 * a segment is set by request_body_rope_segment_capacity().
+		 *
+		 * The body is available via request_t::body_rope(), and
+		 * request_t::body() returns an empty string in that case.
+		 *
+		 * The mode is turned off by default.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		request_body_as_rope( bool v ) &
+		{
+			m_request_body_as_rope = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		request_body_as_rope( bool v ) &&
+		{
+			return std::move( this->request_body_as_rope( v ) );
+		}
+
+		[[nodiscard]]
+		bool
+		request_body_as_rope() const noexcept
+		{
+			return m_request_body_as_rope;
+		}
+		//! }
+
+		//! Capacity of a segment of a request body stored as a rope.
+		/*!
+		 * It doesn't depend on the size of the input buffer: a body
+		 * of N bytes takes about N / capacity segments. The last segment
+		 * of a body with `Content-Length` is no bigger than the rest of
+		 * the body.
+		 *
+		 * Is used only if request_body_as_rope() is turned on.
+		 * The default is body_rope_t::default_segment_capacity.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! {
+		Derived &
+		request_body_rope_segment_capacity( std::size_t v ) &
+		{
+			if( 0u == v )
+				throw exception_t{ "rope segment capacity cannot be zero" };
+
+			m_request_body_rope_segment_capacity = v;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		request_body_rope_segment_capacity( std::size_t v ) &&
+		{
+			return std::move( this->request_body_rope_segment_capacity( v ) );
+		}
+
+		[[nodiscard]]
+		std::size_t
+		request_body_rope_segment_capacity() const noexcept
+		{
+			return m_request_body_rope_segment_capacity;
+		}
+		//! }
+
 		//! A period for holding connection before completely receiving
 		//! new http-request. Starts counting since connection is establised
 		//! or a previous request was responsed.
@@ -838,6 +1162,50 @@ class basic_server_settings_t
 		}
 		//! \}
 
+		/*!
+		 * @name Capacity of the pool of connection objects.
+		 *
+		 * If capacity is greater than zero then memory blocks occupied
+		 * by connection objects and input buffers of connections are
+		 * not released when a connection is closed. They are kept in
+		 * a pool and are reused for new connections. The capacity limits
+		 * the number of kept blocks (and buffers).
+		 *
+		 * Pool is disabled by default (the capacity is zero).
+		 *
+		 * Usage example:
+		 * @code
+		 * restinio::server_settings_t<> settings;
+		 * settings.connection_pool_capacity( 1024u );
+		 * @endcode
+		 *
+		 * @note
+		 * Every instance of http_server_t has its own pool.
+		 *
+		 * @since v.0.7.10
+		 */
+		//! \{
+		Derived &
+		connection_pool_capacity( std::size_t capacity ) &
+		{
+			m_connection_pool_capacity = capacity;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		connection_pool_capacity( std::size_t capacity ) &&
+		{
+			return std::move( this->connection_pool_capacity( capacity ) );
+		}
+
+		[[nodiscard]]
+		std::size_t
+		connection_pool_capacity() const noexcept
+		{
+			return m_connection_pool_capacity;
+		}
+		//! \}
+
 
 		//! Request handler.
 		//! \{
@@ -1093,6 +1461,45 @@ class basic_server_settings_t
 		}
 		//! \}
 
+		//! Max number of connections accepted in a batch.
+		/*!
+			If it isn't 0 then after the completion of an async accept
+			operation the acceptor tries to accept up to @a n more connections
+			from the listen backlog by non-blocking accept() calls
+			(`accept4(SOCK_NONBLOCK|SOCK_CLOEXEC)` on Linux). It allows
+			to drain the backlog without a round-trip via io_context for
+			every connection during connection storms.
+
+			Value 0 (the default) means that a new async accept
+			operation is started for every connection.
+
+			@note
+			Batch accept is used only for plain TCP sockets.
+			The limit for parallel connections is respected.
+
+			@since v.0.7.10
+		*/
+		//! \{
+		Derived &
+		accept_batch_size( std::size_t n ) & noexcept
+		{
+			m_accept_batch_size = n;
+			return reference_to_derived();
+		}
+
+		Derived &&
+		accept_batch_size( std::size_t n ) && noexcept
+		{
+			return std::move( this->accept_batch_size( n ) );
+		}
+
+		std::size_t
+		accept_batch_size() const noexcept
+		{
+			return m_accept_batch_size;
+		}
+		//! \}
+
 		//! \name Cleanup function.
 		//! \{
 		template< typename Func >
@@ -1732,6 +2139,52 @@ class basic_server_settings_t
 		//! Size of buffer for io operations.
 		std::size_t m_buffer_size{ 4 * 1024 };
 
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_initial_buffer_size{ 0u };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		bool m_release_idle_input_buffer{ false };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		bool m_try_write_first{ false };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		bool m_auto_date_field{ false };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_outgoing_data_high_watermark{ 0u };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_outgoing_data_low_watermark{ 0u };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::shared_ptr< response_cache_t > m_response_cache;
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		bool m_request_body_as_rope{ false };
+
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_request_body_rope_segment_capacity{
+				body_rope_t::default_segment_capacity };
+
 		//! Operations timeouts.
 		//! \{
 		std::chrono::steady_clock::duration
@@ -1747,6 +2200,15 @@ class basic_server_settings_t
 		//! Max pipelined requests to receive on single connection.
 		std::size_t m_max_pipelined_requests{ 1 };
 
+		/*!
+		 * @brief Capacity of the pool of connection objects.
+		 *
+		 * Zero means that the pool isn't used.
+		 *
+		 * @since v.0.7.10
+		 */
+		std::size_t m_connection_pool_capacity{ 0u };
+
 		//! Request handler.
 		std::unique_ptr< request_handler_t > m_request_handler;
 
@@ -1777,6 +2239,11 @@ class basic_server_settings_t
 		//! Do separate an accept operation and connection instantiation.
 		bool m_separate_accept_and_create_connect{ false };
 
+		/*!
+		 * @since v.0.7.10
+		 */
+		std::size_t m_accept_batch_size{ 0u };
+
 		//! Optional cleanup functor.
 		cleanup_functor_t m_cleanup_functor;
 
@@ -10,6 +10,12 @@
 
 #include <restinio/tcp_connection_ctx_base.hpp>
 
+#include <restinio/utils/metaprogramming.hpp>
+
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
 namespace restinio
 {
 
@@ -24,4 +30,42 @@ using timer_invocation_cb_t =
 	std::add_pointer< void ( timer_invocation_tag_t , tcp_connection_ctx_weak_handle_t ) >::type
 	;
 
+namespace details
+{
+
+template< typename, typename = restinio::utils::metaprogramming::void_t<> >
+struct timer_guard_has_schedule_at : public std::false_type {};
+
+template< typename Timer_Guard >
+struct timer_guard_has_schedule_at<
+		Timer_Guard,
+		restinio::utils::metaprogramming::void_t<
+				decltype( std::declval< Timer_Guard & >().schedule_at(
+						std::declval< tcp_connection_ctx_weak_handle_t >(),
+						std::declval< std::chrono::steady_clock::time_point >() ) ) > >
+	: public std::true_type
+{};
+
+} /* namespace details */
+
+/*!
+ * @brief Does a timer guard support scheduling of checks at deadlines?
+ *
+ * A timer guard can provide the following method in addition to
+ * `schedule(weak_handle)`:
+ * @code
+ * void schedule_at(
+ * 	tcp_connection_ctx_weak_handle_t weak_handle,
+ * 	std::chrono::steady_clock::time_point deadline );
+ * @endcode
+ * If this method is present then a connection doesn't check its
+ * timeouts periodically. A check is scheduled only at the nearest
+ * deadline of the current operation.
+ *
+ * @since v.0.7.10
+ */
+template< typename Timer_Guard >
+inline constexpr bool timer_guard_supports_deadlines_v =
+		details::timer_guard_has_schedule_at< Timer_Guard >::value;
+
 } /* namespace restinio */
@@ -0,0 +1,425 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief Timer factory implementation using a hierarchical timer wheel.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <restinio/asio_include.hpp>
+
+#include <restinio/utils/suppress_exceptions.hpp>
+
+#include <restinio/impl/timer_wheel.hpp>
+
+#include <restinio/timer_common.hpp>
+#include <restinio/null_mutex.hpp>
+#include <restinio/exception.hpp>
+
+namespace restinio
+{
+
+//
+// basic_timer_wheel_manager_t
+//
+
+/*!
+ * @brief Timer factory implementation using a hierarchical timer wheel.
+ *
+ * Unlike asio_timer_manager_t there is no asio timer for every
+ * connection. There is just one wheel (and one asio timer) per
+ * io_context. Timer guards of connections are entries of that wheel,
+ * so scheduling and canceling of timeout checks are O(1) operations that
+ * don't require any system calls or memory allocations.
+ *
+ * The asio timer is armed only when there are scheduled entries in
+ * the wheel, so an idle server isn't woken up.
+ *
+ * The wheel is turned with granularity of @a tick, so a timeout check
+ * is invoked not earlier than `check_period` and not later than
+ * `check_period + tick` after the scheduling.
+ *
+ * @tparam Mutex A type of mutex for protection of the wheel.
+ * std::mutex has to be used if the server works on a thread pool.
+ * null_mutex_t can be used for a single-threaded server.
+ *
+ * Usage example:
+ * @code
+ * struct my_traits : public restinio::default_traits_t {
+ * 	using timer_manager_t = restinio::timer_wheel_manager_t;
+ * };
+ * ...
+ * restinio::run(
+ * 	restinio::on_thread_pool< my_traits >( 4 )
+ * 		.timer_manager( std::chrono::seconds{ 1 } )
+ * 		...
+ * @endcode
+ *
+ * @since v.0.7.10
+ */
+template< typename Mutex >
+class basic_timer_wheel_manager_t final
+	:	public std::enable_shared_from_this< basic_timer_wheel_manager_t< Mutex > >
+{
+	//! Entry of the wheel.
+	struct entry_t final : public impl::timer_wheel_node_t
+	{
+		tcp_connection_ctx_weak_handle_t m_weak_handle;
+	};
+
+	public:
+		basic_timer_wheel_manager_t(
+			asio_ns::io_context & io_context,
+			std::chrono::steady_clock::duration check_period,
+			std::chrono::steady_clock::duration tick )
+			:	m_timer{ io_context }
+			,	m_tick{ tick }
+			,	m_check_period_ticks{ to_ticks_ceil( check_period, tick ) }
+			,	m_origin{ std::chrono::steady_clock::now() }
+		{}
+
+		//! Timer guard for async operations.
+		/*!
+		 * @note
+		 * Can't be copied or moved because it's linked into the wheel.
+		 * It's not a problem because guards are created in-place in
+		 * connection objects.
+		 */
+		class timer_guard_t final
+		{
+			public:
+				timer_guard_t(
+					std::shared_ptr< basic_timer_wheel_manager_t > manager ) noexcept
+					:	m_manager{ std::move( manager ) }
+				{}
+
+				timer_guard_t( const timer_guard_t & ) = delete;
+				timer_guard_t & operator=( const timer_guard_t & ) = delete;
+
+				~timer_guard_t()
+				{
+					cancel();
+				}
+
+				//! Schedule timeouts check invocation.
+				void
+				schedule( tcp_connection_ctx_weak_handle_t weak_handle )
+				{
+					m_manager->schedule_entry( m_entry, std::move( weak_handle ) );
+				}
+
+				//! Schedule timeouts check invocation at the deadline.
+				void
+				schedule_at(
+					tcp_connection_ctx_weak_handle_t weak_handle,
+					std::chrono::steady_clock::time_point deadline )
+				{
+					m_manager->schedule_entry_at(
+							m_entry, std::move( weak_handle ), deadline );
+				}
+
+				//! Cancel timeout guard if any.
+				void
+				cancel() noexcept
+				{
+					m_manager->cancel_entry( m_entry );
+				}
+
+			private:
+				const std::shared_ptr< basic_timer_wheel_manager_t > m_manager;
+				entry_t m_entry;
+		};
+
+		//! Create guard for connection.
+		timer_guard_t
+		create_timer_guard()
+		{
+			return timer_guard_t{ this->shared_from_this() };
+		}
+
+		//! @name Start/stop timer manager.
+		///@{
+		void
+		start()
+		{
+			std::lock_guard< Mutex > lock{ m_lock };
+
+			m_started = true;
+			if( !m_wheel.empty() )
+				arm_timer( m_wheel.next_tick_to_advance() );
+		}
+
+		void
+		stop() noexcept
+		{
+			std::lock_guard< Mutex > lock{ m_lock };
+
+			m_started = false;
+			m_timer_armed = false;
+			restinio::utils::suppress_exceptions_quietly(
+					[this]{ m_timer.cancel(); } );
+		}
+		///@}
+
+		struct factory_t final
+		{
+			//! Check period for timer events.
+			const std::chrono::steady_clock::duration
+				m_check_period{ std::chrono::seconds{ 1 } };
+
+			//! Granularity of the wheel.
+			const std::chrono::steady_clock::duration
+				m_tick{ std::chrono::milliseconds{ 100 } };
+
+			factory_t() noexcept {}
+			factory_t( std::chrono::steady_clock::duration check_period ) noexcept
+				:	m_check_period{ check_period }
+				,	m_tick{ std::min< std::chrono::steady_clock::duration >(
+						check_period, std::chrono::milliseconds{ 100 } ) }
+			{}
+			factory_t(
+				std::chrono::steady_clock::duration check_period,
+				std::chrono::steady_clock::duration tick ) noexcept
+				:	m_check_period{ check_period }
+				,	m_tick{ tick }
+			{}
+
+			//! Create an instance of timer manager.
+			auto
+			create( asio_ns::io_context & io_context ) const
+			{
+				if( m_tick <= std::chrono::steady_clock::duration::zero() )
+					throw exception_t{ "timer wheel tick must be positive" };
+
+				return std::make_shared< basic_timer_wheel_manager_t >(
+						io_context, m_check_period, m_tick );
+			}
+		};
+
+	private:
+		Mutex m_lock;
+
+		asio_ns::steady_timer m_timer;
+
+		//! Granularity of the wheel.
+		const std::chrono::steady_clock::duration m_tick;
+
+		//! Check period in ticks (rounded up).
+		const std::uint64_t m_check_period_ticks;
+
+		//! The time point of the tick 0.
+		const std::chrono::steady_clock::time_point m_origin;
+
+		impl::timer_wheel_t m_wheel;
+
+		bool m_started{ false };
+		bool m_timer_armed{ false };
+
+		//! The tick for which the timer is armed.
+		std::uint64_t m_armed_tick{ 0u };
+
+		//! A buffer for handles of expired entries.
+		/*!
+		 * on_timer() takes it under the lock and returns it back after
+		 * the processing of expired entries, so the allocated memory is
+		 * reused. If several on_timer() are running in parallel only
+		 * one of them reuses the buffer.
+		 */
+		std::vector< tcp_connection_ctx_weak_handle_t > m_expired;
+
+		[[nodiscard]]
+		static std::uint64_t
+		to_ticks_ceil(
+			std::chrono::steady_clock::duration d,
+			std::chrono::steady_clock::duration tick ) noexcept
+		{
+			if( d <= std::chrono::steady_clock::duration::zero() )
+				return 0u;
+
+			return static_cast< std::uint64_t >(
+					(d + tick - std::chrono::steady_clock::duration{ 1 }) / tick );
+		}
+
+		[[nodiscard]]
+		std::uint64_t
+		tick_of( std::chrono::steady_clock::time_point tp ) const noexcept
+		{
+			return static_cast< std::uint64_t >( (tp - m_origin) / m_tick );
+		}
+
+		void
+		schedule_entry(
+			entry_t & entry,
+			tcp_connection_ctx_weak_handle_t weak_handle )
+		{
+			// The next tick boundary is used as the base, so the check
+			// is not invoked earlier than check_period.
+			const auto now_tick = tick_of( std::chrono::steady_clock::now() );
+			schedule_entry_at_tick(
+					entry,
+					std::move( weak_handle ),
+					now_tick,
+					now_tick + 1u + m_check_period_ticks );
+		}
+
+		void
+		schedule_entry_at(
+			entry_t & entry,
+			tcp_connection_ctx_weak_handle_t weak_handle,
+			std::chrono::steady_clock::time_point deadline )
+		{
+			const auto now = std::chrono::steady_clock::now();
+
+			// The first tick boundary that isn't earlier than the deadline.
+			const auto expires_at = deadline > now ?
+					to_ticks_ceil( deadline - m_origin, m_tick ) : 0u;
+
+			schedule_entry_at_tick(
+					entry,
+					std::move( weak_handle ),
+					tick_of( now ),
+					expires_at );
+		}
+
+		void
+		schedule_entry_at_tick(
+			entry_t & entry,
+			tcp_connection_ctx_weak_handle_t weak_handle,
+			std::uint64_t now_tick,
+			std::uint64_t expires_at )
+		{
+			std::lock_guard< Mutex > lock{ m_lock };
+
+			// An empty wheel isn't turned, so it should be moved to
+			// the current time before the scheduling.
+			if( m_wheel.empty() )
+				m_wheel.advance( now_tick,
+						[]( impl::timer_wheel_node_t & ) noexcept {} );
+
+			entry.m_weak_handle = std::move( weak_handle );
+			m_wheel.schedule( entry, expires_at );
+
+			if( m_started )
+			{
+				// The timer has to be rearmed if the new entry expires
+				// earlier than the timer.
+				const auto next_tick = m_wheel.next_tick_to_advance();
+				if( !m_timer_armed || next_tick < m_armed_tick )
+					arm_timer( next_tick );
+			}
+		}
+
+		void
+		cancel_entry( entry_t & entry ) noexcept
+		{
+			std::lock_guard< Mutex > lock{ m_lock };
+
+			if( entry.is_linked() )
+			{
+				m_wheel.cancel( entry );
+				entry.m_weak_handle.reset();
+			}
+		}
+
+		//! Arm the asio timer.
+		/*!
+		 * @note
+		 * Must be called when m_lock is acquired.
+		 */
+		void
+		arm_timer( std::uint64_t tick )
+		{
+			m_timer.expires_at( m_origin + m_tick * static_cast<
+					std::chrono::steady_clock::duration::rep >( tick ) );
+			m_timer.async_wait(
+					[weak_self = this->weak_from_this()]( const auto & ec ) {
+						if( !ec )
+						{
+							if( auto self = weak_self.lock() )
+								self->on_timer();
+						}
+					} );
+			m_timer_armed = true;
+			m_armed_tick = tick;
+		}
+
+		void
+		on_timer() noexcept
+		{
+			const auto now_tick = tick_of( std::chrono::steady_clock::now() );
+
+			// Expired entries are processed without the lock, so
+			// they are moved to a local container. The timer is rearmed
+			// before the processing and another on_timer() can be called
+			// on another thread at that time.
+			std::vector< tcp_connection_ctx_weak_handle_t > expired;
+
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					std::lock_guard< Mutex > lock{ m_lock };
+
+					m_timer_armed = false;
+					if( !m_started )
+						return;
+
+					expired.swap( m_expired );
+
+					// Can throw, but in that case the wheel isn't turned.
+					expired.reserve( m_wheel.size() );
+
+					m_wheel.advance( now_tick,
+						[&expired]( impl::timer_wheel_node_t & node ) noexcept {
+							auto & entry = static_cast< entry_t & >( node );
+							// Can't throw because the capacity is reserved above.
+							expired.push_back( std::move( entry.m_weak_handle ) );
+						} );
+
+					if( !m_wheel.empty() )
+						arm_timer( m_wheel.next_tick_to_advance() );
+				} );
+
+			// Timeout checks are initiated without the lock because
+			// connections can schedule new checks.
+			for( auto & weak_handle : expired )
+			{
+				if( auto h = weak_handle.lock() )
+				{
+					restinio::utils::suppress_exceptions_quietly(
+							[&]{ h->check_timeout( h ); } );
+				}
+			}
+			expired.clear();
+
+			// Return the buffer for the reuse.
+			restinio::utils::suppress_exceptions_quietly( [&] {
+					std::lock_guard< Mutex > lock{ m_lock };
+					if( expired.capacity() > m_expired.capacity() )
+						expired.swap( m_expired );
+				} );
+		}
+};
+
+//! Timer wheel manager for servers that work on a thread pool.
+/*!
+ * @since v.0.7.10
+ */
+using timer_wheel_manager_t = basic_timer_wheel_manager_t< std::mutex >;
+
+//! Timer wheel manager for single-threaded servers.
+/*!
+ * @since v.0.7.10
+ */
+using single_thread_timer_wheel_manager_t =
+		basic_timer_wheel_manager_t< null_mutex_t >;
+
+} /* namespace restinio */
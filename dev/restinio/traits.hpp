@@ -9,6 +9,7 @@
 #pragma once
 
 #include <restinio/request_handler.hpp>
+#include <restinio/request_allocator.hpp>
 #include <restinio/asio_timer_manager.hpp>
 #include <restinio/null_logger.hpp>
 #include <restinio/connection_state_listener.hpp>
@@ -355,6 +356,30 @@ struct traits_t
 	 * @since v.0.6.13
 	 */
 	using extra_data_factory_t = no_extra_data_factory_t;
+
+	/*!
+	 * @brief The type of allocator for request objects.
+	 *
+	 * A new instance of that type is created for every connection and
+	 * request objects of the connection are created via
+	 * `std::allocate_shared` with an allocator returned by
+	 * `make_allocator<T>()` method. See std_request_allocator_t for
+	 * the details.
+	 *
+	 * By the default std_request_allocator_t is used, so request objects
+	 * are created the same way as by `std::make_shared`. If request
+	 * objects should be created inside a per-connection arena then
+	 * arena_request_allocator_t can be used (it doesn't affect the
+	 * storage of the header and the body of a request):
+	 * @code
+	 * struct my_traits : public restinio::default_traits_t {
+	 * 	using request_allocator_t = restinio::arena_request_allocator_t<>;
+	 * };
+	 * @endcode
+	 *
+	 * @since v.0.7.10
+	 */
+	using request_allocator_t = std_request_allocator_t;
 };
 
 //
@@ -0,0 +1,391 @@
+/*
+	restinio
+*/
+
+/*!
+ * @file
+ * @brief A vector-like container with inline storage for a few items.
+ *
+ * @since v.0.7.10
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace restinio
+{
+
+namespace utils
+{
+
+//
+// small_vector_t
+//
+/*!
+ * @brief A vector-like container with inline storage for @a N items.
+ *
+ * Up to @a N items are stored inside the object itself, so there is no
+ * memory allocation for them. A dynamic buffer is allocated only if more
+ * than @a N items are stored (and it is kept until the destruction of
+ * the container).
+ *
+ * The interface is a subset of std::vector's interface.
+ *
+ * @note
+ * Unlike std::vector iterators and pointers to items are invalidated
+ * when a container with inline storage is moved.
+ *
+ * @tparam T type of items.
+ * @tparam N count of items in the inline storage.
+ *
+ * @since v.0.7.10
+ */
+template< typename T, std::size_t N >
+class small_vector_t
+{
+	static_assert( N > 0u, "inline capacity can't be 0" );
+
+	static constexpr bool nothrow_move =
+			std::is_nothrow_move_constructible_v< T >;
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T &;
+		using const_reference = const T &;
+		using pointer = T *;
+		using const_pointer = const T *;
+		using iterator = T *;
+		using const_iterator = const T *;
+
+		//! Capacity of the inline storage.
+		static constexpr size_type inline_capacity = N;
+
+		small_vector_t() noexcept = default;
+
+		small_vector_t( std::initializer_list< T > items )
+		{
+			reserve( items.size() );
+			for( const auto & item : items )
+				emplace_back( item );
+		}
+
+		small_vector_t( const small_vector_t & o )
+		{
+			reserve( o.size() );
+			for( const auto & item : o )
+				emplace_back( item );
+		}
+
+		small_vector_t( small_vector_t && o ) noexcept( nothrow_move )
+		{
+			take_content_from( o );
+		}
+
+		~small_vector_t()
+		{
+			clear();
+			deallocate_dynamic_storage();
+		}
+
+		small_vector_t &
+		operator=( const small_vector_t & o )
+		{
+			if( this != &o )
+			{
+				small_vector_t tmp{ o };
+				*this = std::move( tmp );
+			}
+
+			return *this;
+		}
+
+		small_vector_t &
+		operator=( small_vector_t && o ) noexcept( nothrow_move )
+		{
+			if( this != &o )
+			{
+				clear();
+				deallocate_dynamic_storage();
+				take_content_from( o );
+			}
+
+			return *this;
+		}
+
+		friend void
+		swap( small_vector_t & a, small_vector_t & b ) noexcept( nothrow_move )
+		{
+			small_vector_t tmp{ std::move( a ) };
+			a = std::move( b );
+			b = std::move( tmp );
+		}
+
+		//! @name Iterators.
+		///@{
+		iterator begin() noexcept { return m_data; }
+		iterator end() noexcept { return m_data + m_size; }
+		const_iterator begin() const noexcept { return m_data; }
+		const_iterator end() const noexcept { return m_data + m_size; }
+		const_iterator cbegin() const noexcept { return m_data; }
+		const_iterator cend() const noexcept { return m_data + m_size; }
+		///@}
+
+		//! @name Access to items.
+		///@{
+		T * data() noexcept { return m_data; }
+		const T * data() const noexcept { return m_data; }
+
+		T & operator[]( size_type i ) noexcept
+		{
+			assert( i < m_size );
+			return m_data[ i ];
+		}
+		const T & operator[]( size_type i ) const noexcept
+		{
+			assert( i < m_size );
+			return m_data[ i ];
+		}
+
+		T & at( size_type i )
+		{
+			if( i >= m_size )
+				throw std::out_of_range{ "small_vector_t: index is out of range" };
+			return m_data[ i ];
+		}
+		const T & at( size_type i ) const
+		{
+			if( i >= m_size )
+				throw std::out_of_range{ "small_vector_t: index is out of range" };
+			return m_data[ i ];
+		}
+
+		T & front() noexcept { return (*this)[ 0u ]; }
+		const T & front() const noexcept { return (*this)[ 0u ]; }
+
+		T & back() noexcept { return (*this)[ m_size - 1u ]; }
+		const T & back() const noexcept { return (*this)[ m_size - 1u ]; }
+		///@}
+
+		//! @name Size and capacity.
+		///@{
+		[[nodiscard]]
+		bool empty() const noexcept { return 0u == m_size; }
+
+		[[nodiscard]]
+		size_type size() const noexcept { return m_size; }
+
+		[[nodiscard]]
+		size_type capacity() const noexcept { return m_capacity; }
+
+		//! Is the inline storage used?
+		[[nodiscard]]
+		bool
+		is_inline() const noexcept { return m_data == inline_data(); }
+
+		void
+		reserve( size_type new_capacity )
+		{
+			if( new_capacity > m_capacity )
+				reallocate( new_capacity );
+		}
+		///@}
+
+		//! @name Modifiers.
+		///@{
+		template< typename... Args >
+		T &
+		emplace_back( Args && ...args )
+		{
+			if( m_size == m_capacity )
+				reallocate( grown_capacity( m_size + 1u ) );
+
+			T * item = ::new( static_cast< void * >( m_data + m_size ) )
+					T( std::forward< Args >( args )... );
+			++m_size;
+
+			return *item;
+		}
+
+		void push_back( const T & v ) { emplace_back( v ); }
+		void push_back( T && v ) { emplace_back( std::move( v ) ); }
+
+		void
+		pop_back() noexcept
+		{
+			assert( !empty() );
+			--m_size;
+			std::destroy_at( m_data + m_size );
+		}
+
+		//! Insert an item before @a pos.
+		iterator
+		insert( const_iterator pos, T v )
+		{
+			const auto index = static_cast< size_type >( pos - cbegin() );
+			assert( index <= m_size );
+
+			emplace_back( std::move( v ) );
+			std::rotate( begin() + index, end() - 1, end() );
+
+			return begin() + index;
+		}
+
+		iterator
+		erase( const_iterator first, const_iterator last )
+		{
+			const auto index = static_cast< size_type >( first - cbegin() );
+			const auto count = static_cast< size_type >( last - first );
+			assert( index + count <= m_size );
+
+			if( count )
+			{
+				std::move( begin() + index + count, end(), begin() + index );
+				for( size_type i = 0u; i != count; ++i )
+					pop_back();
+			}
+
+			return begin() + index;
+		}
+
+		iterator
+		erase( const_iterator pos )
+		{
+			return erase( pos, pos + 1 );
+		}
+
+		void
+		resize( size_type new_size )
+		{
+			if( new_size < m_size )
+			{
+				while( m_size != new_size )
+					pop_back();
+			}
+			else
+			{
+				reserve( new_size );
+				while( m_size != new_size )
+					emplace_back();
+			}
+		}
+
+		//! Remove all items.
+		/*!
+		 * @note
+		 * The dynamic storage (if any) isn't released.
+		 */
+		void
+		clear() noexcept
+		{
+			std::destroy( begin(), end() );
+			m_size = 0u;
+		}
+		///@}
+
+	private:
+		//! Storage for items that are stored inline.
+		alignas( T ) std::byte m_inline_storage[ sizeof( T ) * N ];
+
+		T * m_data{ inline_data() };
+		size_type m_size{ 0u };
+		size_type m_capacity{ N };
+
+		[[nodiscard]]
+		T *
+		inline_data() noexcept
+		{
+			return reinterpret_cast< T * >( m_inline_storage );
+		}
+
+		[[nodiscard]]
+		const T *
+		inline_data() const noexcept
+		{
+			return reinterpret_cast< const T * >( m_inline_storage );
+		}
+
+		[[nodiscard]]
+		size_type
+		grown_capacity( size_type min_capacity ) const noexcept
+		{
+			return std::max( min_capacity, m_capacity * 2u );
+		}
+
+		void
+		reallocate( size_type new_capacity )
+		{
+			std::allocator< T > allocator;
+			T * new_data = allocator.allocate( new_capacity );
+
+			try
+			{
+				// Constructed items are destroyed by uninitialized_move
+				// in the case of an exception.
+				std::uninitialized_move( begin(), end(), new_data );
+			}
+			catch( ... )
+			{
+				allocator.deallocate( new_data, new_capacity );
+				throw;
+			}
+			std::destroy( begin(), end() );
+			deallocate_dynamic_storage();
+
+			m_data = new_data;
+			m_capacity = new_capacity;
+		}
+
+		void
+		deallocate_dynamic_storage() noexcept
+		{
+			if( !is_inline() )
+			{
+				std::allocator< T >{}.deallocate( m_data, m_capacity );
+				m_data = inline_data();
+				m_capacity = N;
+			}
+		}
+
+		//! Take the content of @a o.
+		/*!
+		 * @attention
+		 * This container has to be empty and must not have
+		 * a dynamic storage.
+		 */
+		void
+		take_content_from( small_vector_t & o ) noexcept( nothrow_move )
+		{
+			if( o.is_inline() )
+			{
+				std::uninitialized_move( o.begin(), o.end(), m_data );
+				m_size = o.m_size;
+				o.clear();
+			}
+			else
+			{
+				m_data = o.m_data;
+				m_size = o.m_size;
+				m_capacity = o.m_capacity;
+
+				o.m_data = o.inline_data();
+				o.m_size = 0u;
+				o.m_capacity = N;
+			}
+		}
+};
+
+} /* namespace utils */
+
+} /* namespace restinio */
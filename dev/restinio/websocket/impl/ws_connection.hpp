@@ -18,6 +18,7 @@
 
 #include <restinio/core.hpp>
 #include <restinio/impl/executor_wrapper.hpp>
+#include <restinio/impl/fixed_buffer.hpp>
 #include <restinio/impl/write_group_output_ctx.hpp>
 #include <restinio/websocket/message.hpp>
 #include <restinio/websocket/impl/ws_parser.hpp>
@@ -1147,11 +1148,14 @@ class ws_connection_t final
 				{
 					finish_handling_current_write_ctx();
 				}
-				else
+				else if( std::holds_alternative< file_write_operation_t >( wo ) )
 				{
-					assert( std::holds_alternative< file_write_operation_t >( wo ) );
 					throw exception_t{ "sendfile write operation not implemented" };
 				}
+				else
+				{
+					throw exception_t{ "body generator write operation not implemented" };
+				}
 			}
 			catch( const std::exception & ex )
 			{
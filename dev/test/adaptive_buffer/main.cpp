@@ -0,0 +1,140 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for adaptive input buffer.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/impl/adaptive_buffer.hpp>
+
+using namespace restinio;
+using namespace restinio::impl;
+
+namespace
+{
+
+std::size_t
+asio_buffer_size( adaptive_buffer_t & buf )
+{
+	return asio_ns::buffer_size( buf.make_asio_buffer() );
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "Fixed size" , "[adaptive_buffer][fixed]" )
+{
+	adaptive_buffer_t buf{ {}, 1024u, 1024u };
+
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+
+	buf.obtained_bytes( 1024u );
+	buf.consumed_bytes( 1024u );
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+
+	for( int i = 0; i != 10; ++i )
+	{
+		buf.obtained_bytes( 1u );
+		buf.consumed_bytes( 1u );
+	}
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+}
+
+TEST_CASE( "Growth" , "[adaptive_buffer][grow]" )
+{
+	adaptive_buffer_t buf{ {}, 512u, 4096u };
+
+	REQUIRE( 512u == asio_buffer_size( buf ) );
+
+	buf.obtained_bytes( 512u );
+	// The size isn't changed while there is unconsumed data.
+	REQUIRE( 512u == buf.size() );
+	REQUIRE( 512u == buf.length() );
+
+	buf.consumed_bytes( 100u );
+	REQUIRE( 412u == buf.length() );
+	REQUIRE( 512u == asio_buffer_size( buf ) );
+
+	buf.consumed_bytes( 412u );
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+
+	buf.obtained_bytes( 1024u );
+	buf.consumed_bytes( 1024u );
+	REQUIRE( 2048u == asio_buffer_size( buf ) );
+
+	buf.obtained_bytes( 2048u );
+	buf.consumed_bytes( 2048u );
+	REQUIRE( 4096u == asio_buffer_size( buf ) );
+
+	// Max size is reached.
+	buf.obtained_bytes( 4096u );
+	buf.consumed_bytes( 4096u );
+	REQUIRE( 4096u == asio_buffer_size( buf ) );
+
+	// Not a full read, but not small enough for shrinking.
+	buf.obtained_bytes( 2000u );
+	buf.consumed_bytes( 2000u );
+	REQUIRE( 4096u == asio_buffer_size( buf ) );
+}
+
+TEST_CASE( "Shrinking" , "[adaptive_buffer][shrink]" )
+{
+	adaptive_buffer_t buf{ {}, 512u, 2048u };
+
+	buf.obtained_bytes( 512u );
+	buf.consumed_bytes( 512u );
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+	buf.obtained_bytes( 1024u );
+	buf.consumed_bytes( 1024u );
+	REQUIRE( 2048u == asio_buffer_size( buf ) );
+
+	const auto small_read = [&]{
+		buf.obtained_bytes( 10u );
+		buf.consumed_bytes( 10u );
+		return asio_buffer_size( buf );
+	};
+
+	for( unsigned int i = 1u;
+			i != adaptive_buffer_t::underused_reads_to_shrink; ++i )
+		REQUIRE( 2048u == small_read() );
+	REQUIRE( 1024u == small_read() );
+
+	// A normal read resets the counter of underused reads.
+	for( unsigned int i = 1u;
+			i != adaptive_buffer_t::underused_reads_to_shrink; ++i )
+		REQUIRE( 1024u == small_read() );
+	buf.obtained_bytes( 700u );
+	buf.consumed_bytes( 700u );
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+
+	for( unsigned int i = 1u;
+			i != adaptive_buffer_t::underused_reads_to_shrink; ++i )
+		REQUIRE( 1024u == small_read() );
+	REQUIRE( 512u == small_read() );
+
+	// Min size is reached.
+	for( unsigned int i = 0u;
+			i != adaptive_buffer_t::underused_reads_to_shrink * 2u; ++i )
+		REQUIRE( 512u == small_read() );
+}
+
+TEST_CASE( "Reuse of storage" , "[adaptive_buffer][storage]" )
+{
+	std::vector< char > storage( 1024u );
+	const auto * data = storage.data();
+
+	adaptive_buffer_t buf{ std::move( storage ), 512u, 1024u };
+	REQUIRE( 512u == asio_buffer_size( buf ) );
+	REQUIRE( data == buf.bytes() );
+
+	buf.obtained_bytes( 512u );
+	buf.consumed_bytes( 512u );
+	REQUIRE( 1024u == asio_buffer_size( buf ) );
+
+	// The storage has enough capacity, so it's still the same.
+	storage = buf.giveaway_storage();
+	REQUIRE( data == storage.data() );
+	REQUIRE( 1024u == storage.size() );
+}
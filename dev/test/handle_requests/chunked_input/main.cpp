@@ -621,3 +621,90 @@ TEST_CASE( "Limit violations" , "[chunked-input][simple][limits]" )
 
 	other_thread.stop_and_join();
 }
+
+TEST_CASE( "Chunked body as rope" , "[chunked-input][rope]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.buffer_size( 8u )
+				.request_body_as_rope( true )
+				.request_body_rope_segment_capacity( 8u )
+				.request_handler(
+					[]( auto req ){
+						if( restinio::http_method_post() == req->header().method() )
+						{
+							restinio::fmt_minimal_memory_buffer_t resp_body =
+								format_chunked_input_info( *req );
+
+							std::string segments;
+							for( const auto & s : req->body_rope() )
+							{
+								segments += '|';
+								segments.append( s.data(), s.size() );
+							}
+
+							req->create_response()
+								.append_header( "Server", "RESTinio utest server" )
+								.append_header_date_field()
+								.append_header( "Content-Type", "text/plain; charset=utf-8" )
+								.set_body( fmt::to_string( resp_body ) + segments )
+								.done();
+							return restinio::request_accepted();
+						}
+
+						return restinio::request_rejected();
+					} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string request{
+		"POST /data HTTP/1.0\r\n"
+		"From: unit-test\r\n"
+		"User-Agent: unit-test\r\n"
+		"Content-Type: text/plain\r\n"
+		"Transfer-Encoding: chunked\r\n"
+		"Connection: close\r\n"
+		"\r\n"
+		"6\r\n"
+		"Hello,\r\n"
+		"1\r\n"
+		" \r\n"
+		"6\r\n"
+		"World!\r\n"
+		"0\r\n"
+		"\r\n"
+	};
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request(
+			request,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	REQUIRE_THAT( response,
+			Catch::Matchers::EndsWith(
+					"chunks:3;"
+					"[0,6;ext:nullptr]"
+					"[6,1;ext:nullptr]"
+					"[7,6;ext:nullptr];"
+					"trailing_fields:0;"
+					"|Hello, W|orld!") );
+
+	other_thread.stop_and_join();
+}
@@ -6,6 +6,7 @@
 	Tests for chunked output.
 */
 
+#include <atomic>
 #include <cstdlib>
 #include <thread>
 
@@ -303,3 +304,105 @@ TEST_CASE( "Using user chunked output response builder" , "[chunked_output]" )
 	other_thread.stop_and_join();
 }
 
+
+TEST_CASE( "Chunked output with outgoing data watermarks" , "[chunked_output][watermarks]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	using response_t = restinio::response_builder_t< restinio::chunked_output_t >;
+
+	constexpr std::size_t chunk_size = 4096u;
+	constexpr std::size_t chunks_count = 64u;
+
+	struct producer_t
+	{
+		std::shared_ptr< response_t > m_resp;
+		std::size_t m_chunks_sent{ 0u };
+		std::size_t m_pauses{ 0u };
+
+		static void
+		produce( std::shared_ptr< producer_t > p )
+		{
+			while( p->m_resp->output_is_writable() &&
+					chunks_count != p->m_chunks_sent )
+			{
+				const char ch = static_cast< char >( 'a' + p->m_chunks_sent % 26u );
+				p->m_resp->append_chunk( std::string( chunk_size, ch ) ).flush();
+				++p->m_chunks_sent;
+			}
+
+			if( chunks_count == p->m_chunks_sent )
+				p->m_resp->done();
+			else
+			{
+				++p->m_pauses;
+				p->m_resp->when_output_writable(
+					[p]( const auto & ec ) {
+						if( !ec )
+							produce( p );
+					} );
+			}
+		}
+	};
+
+	std::atomic< std::size_t > pauses{ 0u };
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.outgoing_data_watermarks( 4u * chunk_size, chunk_size )
+				.request_handler(
+					[&]( restinio::request_handle_t req ){
+						auto p = std::make_shared< producer_t >();
+						p->m_resp = std::make_shared< response_t >(
+								req->create_response< restinio::chunked_output_t >() );
+						p->m_resp->connection_close();
+
+						producer_t::produce( p );
+						pauses += p->m_pauses;
+
+						return restinio::request_accepted();
+					} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request(
+			"GET / HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Connection: close\r\n"
+			"\r\n",
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	other_thread.stop_and_join();
+
+	// The handler is paused at least once because data
+	// can't be written until the handler returns.
+	REQUIRE( 0u < pauses );
+
+	std::string expected_body;
+	for( std::size_t i = 0u; i != chunks_count; ++i )
+	{
+		expected_body += "1000\r\n";
+		expected_body += std::string(
+				chunk_size, static_cast< char >( 'a' + i % 26u ) );
+		expected_body += "\r\n";
+	}
+	expected_body += "0\r\n\r\n";
+
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( expected_body ) );
+}
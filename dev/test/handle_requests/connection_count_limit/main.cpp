@@ -81,7 +81,8 @@ perform_test(
 	std::size_t max_parallel_connections,
 	bool separate_accept_and_create_connection,
 	std::size_t server_threads_count,
-	details::client_load_t client_load )
+	details::client_load_t client_load,
+	std::size_t accept_batch_size = 0u )
 {
 	const auto perform_checks =
 		[]( std::size_t iterations, std::uint16_t port )
@@ -189,7 +190,8 @@ perform_test(
 					.concurrent_accepts_count( server_threads_count )
 					.separate_accept_and_create_connect(
 							separate_accept_and_create_connection )
-					.max_parallel_connections( max_parallel_connections ),
+					.max_parallel_connections( max_parallel_connections )
+					.accept_batch_size( accept_batch_size ),
 			server_threads_count );
 
 	std::vector< std::thread > clients;
@@ -239,6 +241,16 @@ TEST_CASE( "thread_safe_connection_limiter, accept-connect separation" , "[threa
 			details::client_load_t{ 16, 40 } );
 }
 
+TEST_CASE( "thread_safe_connection_limiter, batch accept" , "[thread_safe][batch_accept]" )
+{
+	perform_test< details::thread_safe_connection_limiter_traits_t >(
+			8,
+			false,
+			5,
+			details::client_load_t{ 16, 40 },
+			16 );
+}
+
 namespace details
 {
 
@@ -266,3 +278,12 @@ TEST_CASE( "single_thread_connection_limiter, accept-connect separation" , "[sin
 			details::client_load_t{ 10, 40 } );
 }
 
+TEST_CASE( "single_thread_connection_limiter, batch accept" , "[single_thread][batch_accept]" )
+{
+	perform_test< details::single_thread_connection_limiter_traits_t >(
+			8,
+			false,
+			1,
+			details::client_load_t{ 10, 40 },
+			16 );
+}
@@ -0,0 +1,243 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for the pool of connection objects.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio::tests;
+
+TEST_CASE( "connection_pool_t blocks and buffers" , "[connection_pool]" )
+{
+	using namespace restinio::impl;
+
+	REQUIRE_THROWS_AS( connection_pool_t{ 0u }, restinio::exception_t );
+	REQUIRE( nullptr == make_connection_pool( 0u ) );
+
+	auto pool = make_connection_pool( 2u );
+	REQUIRE( nullptr != pool );
+
+	void * b1 = pool->allocate_block( 128u );
+	void * b2 = pool->allocate_block( 128u );
+	void * b3 = pool->allocate_block( 128u );
+
+	REQUIRE( 0u == pool->stats().hits() );
+	REQUIRE( 3u == pool->stats().misses() );
+
+	pool->deallocate_block( b1, 128u );
+	pool->deallocate_block( b2, 128u );
+	// The pool is full, this block must be released.
+	pool->deallocate_block( b3, 128u );
+
+	REQUIRE( 2u == pool->stats().free_blocks() );
+
+	void * b4 = pool->allocate_block( 128u );
+	REQUIRE( (b4 == b1 || b4 == b2) );
+	REQUIRE( 1u == pool->stats().hits() );
+	REQUIRE( 1u == pool->stats().free_blocks() );
+
+	// Blocks of different size are not taken from the pool.
+	void * b5 = pool->allocate_block( 256u );
+	REQUIRE( 1u == pool->stats().hits() );
+	REQUIRE( 4u == pool->stats().misses() );
+
+	pool->deallocate_block( b5, 256u );
+	REQUIRE( 1u == pool->stats().free_blocks() );
+
+	pool->deallocate_block( b4, 128u );
+	REQUIRE( 2u == pool->stats().free_blocks() );
+
+	REQUIRE( pool->acquire_buffer().empty() );
+
+	std::vector< char > buf( 512u, 'x' );
+	const auto * data = buf.data();
+	pool->release_buffer( std::move(buf) );
+
+	auto reused = pool->acquire_buffer();
+	REQUIRE( data == reused.data() );
+	REQUIRE( pool->acquire_buffer().empty() );
+}
+
+TEST_CASE( "connection objects are taken from pool" , "[connection_pool]" )
+{
+	using traits_t =
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t >;
+
+	using http_server_t = restinio::http_server_t< traits_t >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.connection_pool_capacity( 16u )
+				.request_handler(
+					[]( auto req ){
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	const std::size_t requests = 16u;
+	for( std::size_t i = 0u; i != requests; ++i )
+	{
+		const std::string body = "request #" + std::to_string( i );
+
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request(
+				"POST /data HTTP/1.0\r\n"
+				"From: unit-test\r\n"
+				"User-Agent: unit-test\r\n"
+				"Content-Type: application/x-www-form-urlencoded\r\n"
+				"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+				"Connection: close\r\n"
+				"\r\n" +
+				body,
+				default_ip_addr(),
+				port_getter.port() ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( body ) );
+	}
+
+	other_thread.stop_and_join();
+
+	const auto stats = http_server.connection_pool_stats();
+	REQUIRE( requests == stats.hits() + stats.misses() );
+	REQUIRE( 0u != stats.hits() );
+}
+
+TEST_CASE( "connection pool is disabled by default" , "[connection_pool]" )
+{
+	using http_server_t = restinio::http_server_t<>;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.request_handler( []( auto ){
+						return restinio::request_rejected();
+					} );
+		} };
+
+	const auto stats = http_server.connection_pool_stats();
+	REQUIRE( 0u == stats.hits() );
+	REQUIRE( 0u == stats.misses() );
+}
+
+TEST_CASE( "input buffer is released while connection is idle" ,
+		"[connection_pool][release_idle_input_buffer]" )
+{
+	using traits_t =
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t >;
+
+	using http_server_t = restinio::http_server_t< traits_t >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.connection_pool_capacity( 16u )
+				.release_idle_input_buffer( true )
+				.request_handler(
+					[]( auto req ){
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	const auto make_request = []( const std::string & body ) {
+		return
+			"POST /data HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Type: application/x-www-form-urlencoded\r\n"
+			"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+			"\r\n" +
+			body;
+	};
+
+	const auto read_response = []( auto & socket, const std::string & body ) {
+		const std::size_t content_length = body.size();
+
+		restinio::asio_ns::streambuf response_stream;
+		const auto header_size = restinio::asio_ns::read_until(
+				socket, response_stream, "\r\n\r\n" );
+		if( response_stream.size() < header_size + content_length )
+			restinio::asio_ns::read(
+					socket,
+					response_stream,
+					restinio::asio_ns::transfer_exactly(
+						header_size + content_length - response_stream.size() ) );
+
+		std::ostringstream sout;
+		sout << &response_stream;
+		return sout.str();
+	};
+
+	do_with_socket( [&]( auto & socket, auto & /*io_context*/ )
+		{
+			for( int i = 0; i != 3; ++i )
+			{
+				const std::string body = "request #" + std::to_string( i );
+				restinio::asio_ns::write( socket,
+						restinio::asio_ns::buffer( make_request( body ) ) );
+
+				REQUIRE_THAT( read_response( socket, body ),
+						Catch::Matchers::EndsWith( body ) );
+
+				// The connection is idle now, so its input buffer
+				// should be returned to the pool.
+				std::size_t free_buffers{};
+				for( int attempt = 0; attempt != 100; ++attempt )
+				{
+					free_buffers = http_server.connection_pool_stats().free_buffers();
+					if( 1u == free_buffers )
+						break;
+					std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+				}
+				REQUIRE( 1u == free_buffers );
+			}
+		},
+		default_ip_addr(),
+		port_getter.port() );
+
+	other_thread.stop_and_join();
+}
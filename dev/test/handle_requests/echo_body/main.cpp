@@ -144,6 +144,148 @@ perform_test()
 
 		other_thread.stop_and_join();
 	}
+
+	SECTION( "adaptive input buffer" )
+	{
+		random_port_getter_t port_getter;
+		http_server_t http_server{
+			restinio::own_io_context(),
+			[&request_handler, &port_getter]( auto & settings ){
+				settings
+					.port( 0 )
+					.address( default_ip_addr() )
+					.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+					.buffer_size( 1024u )
+					.initial_buffer_size( 16u )
+					.request_handler( request_handler );
+			}
+		};
+
+		other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+		other_thread.run();
+
+		perform_checks( port_getter.port() );
+
+		other_thread.stop_and_join();
+	}
+
+	SECTION( "try write first" )
+	{
+		random_port_getter_t port_getter;
+		http_server_t http_server{
+			restinio::own_io_context(),
+			[&request_handler, &port_getter]( auto & settings ){
+				settings
+					.port( 0 )
+					.address( default_ip_addr() )
+					.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+					.try_write_first( true )
+					.request_handler( request_handler );
+			}
+		};
+
+		other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+		other_thread.run();
+
+		perform_checks( port_getter.port() );
+
+		other_thread.stop_and_join();
+	}
+
+	SECTION( "body as rope" )
+	{
+		random_port_getter_t port_getter;
+		http_server_t http_server{
+			restinio::own_io_context(),
+			[&port_getter]( auto & settings ){
+				settings
+					.port( 0 )
+					.address( default_ip_addr() )
+					.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+					.buffer_size( 1024u )
+					.request_body_as_rope( true )
+					.request_body_rope_segment_capacity( 1024u )
+					.request_handler( []( auto req ) {
+						if( restinio::http_method_post() != req->header().method() ||
+								!req->body().empty() )
+							return restinio::request_rejected();
+
+						const auto & rope = req->body_rope();
+						const auto expected_segments =
+							( rope.size() + 1023u ) / 1024u;
+						if( expected_segments != rope.segments_count() )
+							return restinio::request_rejected();
+
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( rope.flatten() )
+							.done();
+						return restinio::request_accepted();
+					} );
+			}
+		};
+
+		other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+		other_thread.run();
+
+		perform_checks( port_getter.port() );
+
+		other_thread.stop_and_join();
+	}
+
+	SECTION( "large body as rope" )
+	{
+		random_port_getter_t port_getter;
+		http_server_t http_server{
+			restinio::own_io_context(),
+			[&port_getter]( auto & settings ){
+				settings
+					.port( 0 )
+					.address( default_ip_addr() )
+					.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+					.request_body_as_rope( true )
+					.request_handler( []( auto req ) {
+						const auto & rope = req->body_rope();
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( std::to_string( rope.size() ) + ":" +
+								std::to_string( rope.segments_count() ) + ":" +
+								std::to_string( rope.segment( 0u ).size() ) )
+							.done();
+						return restinio::request_accepted();
+					} );
+			}
+		};
+
+		other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+		other_thread.run();
+
+		// The segment size doesn't depend on the size of the input buffer.
+		const std::size_t segment_capacity =
+			restinio::body_rope_t::default_segment_capacity;
+		const std::string body( 16u * segment_capacity + 1u, 'a' );
+
+		std::string response;
+		REQUIRE_NOTHROW( response = do_request(
+				"POST /data HTTP/1.0\r\n"
+				"Content-Length: " + std::to_string( body.size() ) + "\r\n"
+				"Connection: close\r\n"
+				"\r\n" +
+				body,
+				default_ip_addr(),
+				port_getter.port() ) );
+
+		REQUIRE_THAT( response,
+				Catch::Matchers::EndsWith(
+					std::to_string( body.size() ) + ":17:" +
+					std::to_string( segment_capacity ) ) );
+
+		other_thread.stop_and_join();
+	}
 }
 
 namespace restinio::tests
@@ -0,0 +1,187 @@
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio::tests;
+
+namespace
+{
+
+using http_server_t =
+	restinio::http_server_t<
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t > >;
+
+template< typename Handler >
+std::string
+get_response( Handler && handler )
+{
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[ & ]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.request_handler( std::forward< Handler >( handler ) );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	REQUIRE_NOTHROW( response = do_request(
+			request_str,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	other_thread.stop_and_join();
+
+	return response;
+}
+
+//! Generates CSV-like lines "<n>;<n*n>\n".
+class lines_generator_t
+{
+	public:
+		explicit lines_generator_t( std::size_t lines_count )
+			:	m_lines_count{ lines_count }
+		{}
+
+		std::size_t
+		operator()( char * buf, std::size_t capacity )
+		{
+			std::size_t size{ 0u };
+			while( capacity != size )
+			{
+				if( m_pending.empty() )
+				{
+					if( m_lines_count == m_current_line )
+						break;
+					m_pending = make_line( m_current_line++ );
+				}
+
+				const auto n = std::min( capacity - size, m_pending.size() );
+				std::memcpy( buf + size, m_pending.data(), n );
+				m_pending.erase( 0u, n );
+				size += n;
+			}
+
+			return size;
+		}
+
+		static std::string
+		make_line( std::size_t n )
+		{
+			return std::to_string( n ) + ";" + std::to_string( n * n ) + "\n";
+		}
+
+		static std::string
+		make_all( std::size_t lines_count )
+		{
+			std::string result;
+			for( std::size_t i = 0u; i != lines_count; ++i )
+				result += make_line( i );
+			return result;
+		}
+
+	private:
+		const std::size_t m_lines_count;
+		std::size_t m_current_line{ 0u };
+		std::string m_pending;
+};
+
+} /* namespace anonymous */
+
+TEST_CASE(
+	"RC & body generator" ,
+	"[restinio_controlled_output][body_generator]" )
+{
+	// More than the size of the buffer for generated data.
+	constexpr std::size_t lines_count = 20000u;
+	const auto expected_body = lines_generator_t::make_all( lines_count );
+
+	const auto response = get_response(
+		[ & ]( auto req ){
+			return
+				req->create_response()
+					.append_header( "Server", "RESTinio utest server" )
+					.append_header( restinio::http_field::content_type, "text/csv" )
+					.set_body( restinio::body_generator(
+							expected_body.size(),
+							lines_generator_t{ lines_count } ) )
+					.done();
+		} );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring(
+			fmt::format( RESTINIO_FMT_FORMAT_STRING( "Content-Length: {}" ),
+				expected_body.size() ) ) );
+	REQUIRE_THAT( response,
+		Catch::Matchers::EndsWith( "\r\n\r\n" + expected_body ) );
+}
+
+TEST_CASE(
+	"Chunked & body generator" ,
+	"[chunked_output][body_generator]" )
+{
+	const auto response = get_response(
+		[ & ]( auto req ){
+			auto resp = req->template create_response< restinio::chunked_output_t >();
+			resp.append_chunk( std::string{ "Hello" } )
+				.append_chunk( restinio::body_generator(
+						6u,
+						[]( char * buf, std::size_t capacity ) {
+							REQUIRE( 6u == capacity );
+							std::memcpy( buf, ", Gen!", 6u );
+							return std::size_t{ 6u };
+						} ) )
+				.append_chunk( std::string{ " Bye" } );
+
+			return resp.done();
+		} );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::EndsWith(
+			"5\r\nHello\r\n"
+			"6\r\n, Gen!\r\n"
+			"4\r\n Bye\r\n"
+			"0\r\n\r\n" ) );
+}
+
+TEST_CASE(
+	"RC & broken body generator" ,
+	"[restinio_controlled_output][body_generator]" )
+{
+	const auto response = get_response(
+		[ & ]( auto req ){
+			return
+				req->create_response()
+					.set_body( restinio::body_generator(
+							100u,
+							[]( char *, std::size_t ) -> std::size_t {
+								throw std::runtime_error{ "generator failure" };
+							} ) )
+					.done();
+		} );
+
+	// The header is written but the connection is closed without the body.
+	REQUIRE_THAT( response,
+		Catch::Matchers::StartsWith( "HTTP/1.1 200 OK\r\n" ) );
+	REQUIRE_THAT( response,
+		Catch::Matchers::EndsWith( "Content-Length: 100\r\n\r\n" ) );
+}
@@ -0,0 +1,201 @@
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio::tests;
+
+namespace
+{
+
+using http_server_t =
+	restinio::http_server_t<
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t > >;
+
+template< typename Handler, typename Settings_Tuner >
+std::string
+get_direct_output_response(
+	Handler && handler,
+	Settings_Tuner && settings_tuner )
+{
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[ & ]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.request_handler( std::forward< Handler >( handler ) );
+			settings_tuner( settings );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	REQUIRE_NOTHROW( response = do_request(
+			request_str,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	other_thread.stop_and_join();
+
+	return response;
+}
+
+} /* namespace anonymous */
+
+TEST_CASE(
+	"Direct output & multiple body parts" ,
+	"[restinio_controlled_direct_output][body]" )
+{
+	const auto response = get_direct_output_response(
+		[]( auto req ){
+			return
+				req->template create_response<
+						restinio::restinio_controlled_direct_output_t >()
+					.append_header( "Server", "RESTinio utest server" )
+					.append_header(
+						restinio::http_field::content_type,
+						"text/plain; charset=utf-8" )
+					.set_body( std::string{ "Ignored" } )
+					.set_body( std::string{ "Hello, " } )
+					.append_body( restinio::const_buffer( "World" ) )
+					.append_body( std::string{} )
+					.done();
+		},
+		[]( auto & ) {} );
+
+	REQUIRE( response ==
+			"HTTP/1.1 200 OK\r\n"
+			"Server: RESTinio utest server\r\n"
+			"Content-Type: text/plain; charset=utf-8\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 12\r\n"
+			"\r\n"
+			"Hello, World" );
+}
+
+TEST_CASE(
+	"Direct output & custom status line & header template" ,
+	"[restinio_controlled_direct_output][header_template]" )
+{
+	const restinio::header_template_t tmpl{
+			{ restinio::http_field::cache_control, std::string{ "no-cache" } }
+		};
+
+	const auto response = get_direct_output_response(
+		[ & ]( auto req ){
+			return
+				req->template create_response<
+						restinio::restinio_controlled_direct_output_t >(
+							restinio::http_status_line_t{
+								restinio::status_code::ok, "Fine" } )
+					.use_header_template( tmpl )
+					.append_header( "X-Response", "1" )
+					.set_body( std::string{ "body" } )
+					.done();
+		},
+		[]( auto & ) {} );
+
+	REQUIRE( response ==
+			"HTTP/1.1 200 Fine\r\n"
+			"X-Response: 1\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 4\r\n"
+			"Cache-Control: no-cache\r\n"
+			"\r\n"
+			"body" );
+}
+
+TEST_CASE(
+	"Direct output & auto Date field" ,
+	"[restinio_controlled_direct_output][auto_date_field]" )
+{
+	SECTION( "Date is added" )
+	{
+		const auto response = get_direct_output_response(
+			[]( auto req ){
+				return
+					req->template create_response<
+							restinio::restinio_controlled_direct_output_t >()
+						.set_body( std::string{ "body" } )
+						.done();
+			},
+			[]( auto & settings ) { settings.auto_date_field( true ); } );
+
+		REQUIRE_THAT( response,
+			Catch::Matchers::ContainsSubstring( "\r\nDate: " ) );
+	}
+
+	SECTION( "Date isn't duplicated" )
+	{
+		const auto response = get_direct_output_response(
+			[]( auto req ){
+				return
+					req->template create_response<
+							restinio::restinio_controlled_direct_output_t >()
+						.append_header( "date", "Thu, 01 Jan 1970 00:00:00 GMT" )
+						.set_body( std::string{ "body" } )
+						.done();
+			},
+			[]( auto & settings ) { settings.auto_date_field( true ); } );
+
+		REQUIRE_THAT( response,
+			Catch::Matchers::ContainsSubstring(
+				"\r\ndate: Thu, 01 Jan 1970 00:00:00 GMT\r\n" ) );
+		REQUIRE_THAT( response,
+			!Catch::Matchers::ContainsSubstring( "\r\nDate: " ) );
+	}
+}
+
+TEST_CASE(
+	"Output buffer pool" ,
+	"[output_buffer_pool]" )
+{
+	using restinio::impl::output_buffer_pool_t;
+
+	output_buffer_pool_t pool;
+
+	REQUIRE( pool.acquire().empty() );
+
+	{
+		// Small strings without dynamic memory aren't kept.
+		pool.release( std::string{} );
+		REQUIRE( pool.acquire().capacity() == std::string{}.capacity() );
+	}
+
+	{
+		std::string buf;
+		buf.reserve( 512u );
+		buf.assign( "data" );
+		pool.release( std::move( buf ) );
+
+		const auto reused = pool.acquire();
+		REQUIRE( reused.empty() );
+		REQUIRE( reused.capacity() >= 512u );
+
+		REQUIRE( pool.acquire().capacity() == std::string{}.capacity() );
+	}
+
+	{
+		std::string big;
+		big.reserve( output_buffer_pool_t::max_buffer_capacity + 1u );
+		pool.release( std::move( big ) );
+		REQUIRE( pool.acquire().capacity() == std::string{}.capacity() );
+	}
+}
@@ -0,0 +1,144 @@
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio::tests;
+
+namespace
+{
+
+using http_server_t =
+	restinio::http_server_t<
+		restinio::traits_t<
+			restinio::asio_timer_manager_t,
+			utest_logger_t > >;
+
+const restinio::header_template_t &
+common_fields()
+{
+	static const restinio::header_template_t tmpl{
+			{ std::string{ "Server" }, std::string{ "RESTinio utest server" } },
+			{ restinio::http_field::content_type,
+				std::string{ "text/plain; charset=utf-8" } }
+		};
+
+	return tmpl;
+}
+
+template< typename Handler >
+std::string
+get_response( Handler && handler )
+{
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[ & ]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.request_handler( std::forward< Handler >( handler ) );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	REQUIRE_NOTHROW( response = do_request(
+			request_str,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	other_thread.stop_and_join();
+
+	return response;
+}
+
+} /* namespace anonymous */
+
+TEST_CASE(
+	"RC & header template" ,
+	"[restinio_controlled_output][header_template]" )
+{
+	const std::string resp_message = "RC & header template";
+
+	const auto response = get_response(
+		[ & ]( auto req ){
+			return
+				req->create_response()
+					.use_header_template( common_fields() )
+					.append_header( "X-Response", "1" )
+					.set_body( resp_message )
+					.done();
+		} );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::StartsWith( "HTTP/1.1 200 OK\r\n" ) );
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring(
+			"X-Response: 1\r\n"
+			"Server: RESTinio utest server\r\n"
+			"Content-Type: text/plain; charset=utf-8\r\n"
+			"\r\n" + resp_message ) );
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring(
+			fmt::format( RESTINIO_FMT_FORMAT_STRING( "Content-Length: {}" ),
+				resp_message.size() ) ) );
+}
+
+TEST_CASE(
+	"User controlled & header template" ,
+	"[user_controlled_output][header_template]" )
+{
+	const std::string resp_message = "User controlled & header template";
+
+	const auto response = get_response(
+		[ & ]( auto req ){
+			return
+				req->template create_response< restinio::user_controlled_output_t >()
+					.use_header_template( common_fields() )
+					.set_content_length( resp_message.size() )
+					.set_body( resp_message )
+					.done();
+		} );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring(
+			"Server: RESTinio utest server\r\n"
+			"Content-Type: text/plain; charset=utf-8\r\n"
+			"\r\n" + resp_message ) );
+}
+
+TEST_CASE(
+	"Chunked & header template" ,
+	"[chunked_output][header_template]" )
+{
+	const auto response = get_response(
+		[ & ]( auto req ){
+			return
+				req->template create_response< restinio::chunked_output_t >()
+					.use_header_template( common_fields() )
+					.append_chunk( std::string{ "Hello" } )
+					.done();
+		} );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring(
+			"Transfer-Encoding: chunked\r\n"
+			"Server: RESTinio utest server\r\n"
+			"Content-Type: text/plain; charset=utf-8\r\n"
+			"\r\n"
+			"5\r\nHello\r\n0\r\n\r\n" ) );
+}
@@ -714,3 +714,62 @@ TEST_CASE(
 	other_thread.stop_and_join();
 }
 
+
+TEST_CASE(
+	"RC & std::string & auto Date field" ,
+	"[restinio_controlled_output][std::string][auto_date_field]" )
+{
+	const std::string resp_message = "RC & std::string & auto Date field";
+
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[ & ]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.auto_date_field( true )
+				.request_handler(
+					[ & ]( auto req ){
+						return
+							req->create_response()
+								.append_header( "Server", "RESTinio utest server" )
+								.set_body( std::string{ resp_message } )
+								.done();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string response;
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	REQUIRE_NOTHROW( response = do_request(
+			request_str,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring( "\r\nDate: " ) );
+	REQUIRE_THAT( response,
+		Catch::Matchers::ContainsSubstring( " GMT\r\n" ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( resp_message ) );
+
+	other_thread.stop_and_join();
+}
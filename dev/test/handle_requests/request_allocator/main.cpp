@@ -0,0 +1,153 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for request allocators.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+using namespace restinio::tests;
+
+TEST_CASE( "request_arena_t" , "[request_allocator]" )
+{
+	using namespace restinio::impl;
+
+	request_arena_t arena{ 256u };
+
+	void * p1 = arena.allocate( 100u, alignof(std::max_align_t) );
+	void * p2 = arena.allocate( 100u, alignof(std::max_align_t) );
+	REQUIRE( p1 != p2 );
+	REQUIRE( 0u == reinterpret_cast< std::uintptr_t >( p2 ) %
+			alignof(std::max_align_t) );
+	REQUIRE( 2u == arena.arena_allocations() );
+
+	// There is no space in the arena.
+	void * p3 = arena.allocate( 100u, alignof(std::max_align_t) );
+	REQUIRE( 1u == arena.heap_allocations() );
+
+	arena.deallocate( p3 );
+	arena.deallocate( p1 );
+
+	// p2 is still alive, so arena isn't rewound.
+	void * p4 = arena.allocate( 100u, alignof(std::max_align_t) );
+	REQUIRE( 2u == arena.heap_allocations() );
+	arena.deallocate( p4 );
+
+	arena.deallocate( p2 );
+
+	// There are no live objects, arena should be rewound.
+	void * p5 = arena.allocate( 100u, alignof(std::max_align_t) );
+	REQUIRE( p1 == p5 );
+	REQUIRE( 3u == arena.arena_allocations() );
+	arena.deallocate( p5 );
+}
+
+TEST_CASE( "allocate_shared with arena allocator" , "[request_allocator]" )
+{
+	restinio::arena_request_allocator_t< 512u > allocator;
+
+	std::weak_ptr< std::string > weak;
+	const void * first_address = nullptr;
+	{
+		auto s = std::allocate_shared< std::string >(
+				allocator.make_allocator< std::string >(), "Hello" );
+		weak = s;
+		first_address = s.get();
+		REQUIRE( "Hello" == *s );
+	}
+	REQUIRE( weak.expired() );
+	// Weak pointer still holds the control block.
+	weak.reset();
+
+	auto s2 = std::allocate_shared< std::string >(
+			allocator.make_allocator< std::string >(), "World" );
+	REQUIRE( first_address == s2.get() );
+	REQUIRE( 2u == allocator.arena().arena_allocations() );
+	REQUIRE( 0u == allocator.arena().heap_allocations() );
+}
+
+namespace restinio::tests
+{
+
+struct arena_traits_t : public restinio::default_traits_t {
+	using logger_t = utest_logger_t;
+	using request_allocator_t = restinio::arena_request_allocator_t<>;
+};
+
+} /* namespace restinio::tests */
+
+TEST_CASE( "HTTP echo server with arena request allocator" , "[request_allocator]" )
+{
+	static_assert( std::is_same_v<
+			restinio::std_request_allocator_t,
+			restinio::request_allocator_type_from_traits_t<
+					restinio::default_traits_t > > );
+	static_assert( std::is_same_v<
+			restinio::arena_request_allocator_t<>,
+			restinio::request_allocator_type_from_traits_t< arena_traits_t > > );
+
+	using http_server_t = restinio::http_server_t< arena_traits_t >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.max_pipelined_requests( 4 )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.request_handler(
+					[]( auto req ){
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body( req->body() )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string request;
+	for( int i = 0; i != 3; ++i )
+	{
+		request +=
+			"POST /data HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Content-Length: 6\r\n"
+			"\r\n"
+			"body-" + std::to_string( i );
+	}
+	request += 
+		"POST /data HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"Content-Length: 4\r\n"
+		"Connection: close\r\n"
+		"\r\n"
+		"last";
+
+	std::string response;
+	REQUIRE_NOTHROW( response = do_request(
+			request,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::ContainsSubstring( "body-0" ) );
+	REQUIRE_THAT( response, Catch::Matchers::ContainsSubstring( "body-1" ) );
+	REQUIRE_THAT( response, Catch::Matchers::ContainsSubstring( "body-2" ) );
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( "last" ) );
+
+	other_thread.stop_and_join();
+}
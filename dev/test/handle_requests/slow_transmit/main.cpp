@@ -102,3 +102,98 @@ TEST_CASE( "Slow transmit" , "[slow_trunsmit]" )
 	other_thread.stop_and_join();
 }
 
+
+TEST_CASE( "Slow transmit of header fields" , "[slow_trunsmit][fields]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.read_next_http_message_timelimit( std::chrono::seconds( 5 ) )
+				.request_handler( []( auto req ){
+					std::string body;
+					for( const auto & f : req->header() )
+					{
+						body += '[';
+						body += f.name();
+						body += '=';
+						body += f.value();
+						body += ']';
+					}
+
+					req->create_response()
+						.append_header( "Server", "RESTinio utest server" )
+						.append_header( "Content-Type", "text/plain; charset=utf-8" )
+						.set_body( std::move( body ) )
+						.done();
+
+					return restinio::request_accepted();
+				} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	do_with_socket( [ & ]( auto & socket, auto & io_context )
+		{
+			const std::string request{
+				"GET / HTTP/1.1\r\n"
+				"Host: 127.0.0.1\r\n"
+				"X-Long-Field-Name-For-Slow-Transmit: "
+					"some long value that is received in several parts\r\n"
+				"X-Empty:\r\n"
+				"Connection: close\r\n"
+				"\r\n" };
+
+			// Send the request by small pieces, so names and values
+			// of fields are split between several reads.
+			for( std::size_t i = 0u; i < request.size(); i += 5u )
+			{
+				REQUIRE_NOTHROW(
+					restinio::asio_ns::write(
+							socket,
+							restinio::asio_ns::buffer(
+								request.data() + i,
+								std::min< std::size_t >( 5u, request.size() - i ) ) )
+					);
+				std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+			}
+
+			std::array< char, 1024 > data{};
+
+			socket.async_read_some(
+				restinio::asio_ns::buffer( data.data(), data.size() ),
+				[ & ]( auto ec, std::size_t length ){
+
+					REQUIRE( 0 != length );
+					REQUIRE_FALSE( ec );
+
+					const std::string response{ data.data(), length };
+
+					REQUIRE_THAT( response, Catch::Matchers::EndsWith(
+							"[Host=127.0.0.1]"
+							"[X-Long-Field-Name-For-Slow-Transmit="
+								"some long value that is received in several parts]"
+							"[X-Empty=]"
+							"[Connection=close]" ) );
+				} );
+
+			io_context.run();
+		},
+		default_ip_addr(),
+		port_getter.port() );
+
+	other_thread.stop_and_join();
+}
@@ -219,3 +219,127 @@ TEST_CASE( "Timeout on handling request" , "[timeout][handle_request]" )
 	req_to_store.reset();
 }
 
+
+TEST_CASE( "Timeout is detected at the deadline (asio timer manager)" , "[timeout][read][deadline]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				// Check period is much longer than the timeout, but
+				// the timeout should be detected at the deadline.
+				.timer_manager( std::chrono::seconds( 30 ) )
+				.read_next_http_message_timelimit( std::chrono::milliseconds( 5 ) )
+				.request_handler( []( auto ){
+					return restinio::request_rejected();
+				} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	const auto started_at = std::chrono::steady_clock::now();
+
+	do_with_socket( [ & ]( auto & socket, auto & /*io_context*/ )
+		{
+			const std::string a_part_of_request{ "GET / HTT" };
+
+			REQUIRE_NOTHROW(
+				restinio::asio_ns::write(
+						socket,
+						restinio::asio_ns::buffer( a_part_of_request ) )
+				);
+
+			std::array< char, 64 > data{};
+			restinio::asio_ns::error_code error;
+
+			size_t length = restinio::asio_ns::read(
+					socket,
+					restinio::asio_ns::buffer(data),
+					error );
+
+			REQUIRE( 0 == length );
+			REQUIRE( error == restinio::asio_ns::error::eof );
+			REQUIRE( std::chrono::seconds( 10 ) >
+					std::chrono::steady_clock::now() - started_at );
+		},
+		default_ip_addr(),
+		port_getter.port() );
+
+	other_thread.stop_and_join();
+}
+
+TEST_CASE( "Timeout is detected at the deadline (timer wheel)" , "[timeout][read][deadline][timer_wheel]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::timer_wheel_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&port_getter]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				// Check period is much longer than the timeout, but
+				// the timeout should be detected at the deadline.
+				.timer_manager(
+						std::chrono::seconds( 30 ),
+						std::chrono::milliseconds( 1 ) )
+				.read_next_http_message_timelimit( std::chrono::milliseconds( 5 ) )
+				.request_handler( []( auto ){
+					return restinio::request_rejected();
+				} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	const auto started_at = std::chrono::steady_clock::now();
+
+	do_with_socket( [ & ]( auto & socket, auto & /*io_context*/ )
+		{
+			const std::string a_part_of_request{ "GET / HTT" };
+
+			REQUIRE_NOTHROW(
+				restinio::asio_ns::write(
+						socket,
+						restinio::asio_ns::buffer( a_part_of_request ) )
+				);
+
+			std::array< char, 64 > data{};
+			restinio::asio_ns::error_code error;
+
+			size_t length = restinio::asio_ns::read(
+					socket,
+					restinio::asio_ns::buffer(data),
+					error );
+
+			REQUIRE( 0 == length );
+			REQUIRE( error == restinio::asio_ns::error::eof );
+			REQUIRE( std::chrono::seconds( 10 ) >
+					std::chrono::steady_clock::now() - started_at );
+		},
+		default_ip_addr(),
+		port_getter.port() );
+
+	other_thread.stop_and_join();
+}
@@ -59,7 +59,7 @@ TEST_CASE( "Working with fields (by name)" , "[header][fields][by_name]" )
 		fields.get_field_or( "Content-Type-XXX", "default-value" )
 			== "default-value" );
 
-	impl::append_last_field_accessor( fields, "; charset=utf-8" );
+	fields.append_field( "Content-Type", "; charset=utf-8" );
 
 	REQUIRE(
 		fields.get_field( "Content-Type" ) == "text/plain; charset=utf-8" );
@@ -235,7 +235,7 @@ TEST_CASE( "Working with fields (by id)" , "[header][fields][by_id]" )
 	REQUIRE( fields.get_field_or( "CONTENT-TYPE", "WRONG2" ) == "text/plain" );
 	REQUIRE( fields.get_field( "content-type" ) == "text/plain" );
 
-	impl::append_last_field_accessor( fields, "; charset=utf-8" );
+	fields.append_field( http_field::content_type, "; charset=utf-8" );
 
 	REQUIRE(
 		fields.get_field( http_field::content_type ) == "text/plain; charset=utf-8" );
@@ -943,6 +943,95 @@ TEST_CASE( "working with string_to_field()" , "[header][string_to_field]" )
 #undef RESTINIO_FIELD_FROM_STRIN_TEST
 }
 
+TEST_CASE( "string_to_field() for unknown names" , "[header][string_to_field]" )
+{
+	REQUIRE( http_field::content_type == string_to_field( "content-TYPE" ) );
+	REQUIRE( http_field::a_im == string_to_field( "a-im" ) );
+
+	REQUIRE( http_field::field_unspecified == string_to_field( "" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "X" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Content-Typ" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Content-Types" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Connection" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field( "Content-Length" ) );
+	REQUIRE( http_field::field_unspecified == string_to_field(
+			"Access-Control-Allow-Credentials-And-Something-Else" ) );
+}
+
+TEST_CASE( "Index of known fields" , "[header][fields][index]" )
+{
+	http_header_fields_t fields;
+
+	// Enough fields to have the index.
+	for( int i = 0; i != 40; ++i )
+		fields.add_field( "X-Custom-" + std::to_string( i ), std::to_string( i ) );
+
+	fields.add_field( http_field::accept, "text/plain" );
+	fields.add_field( "Accept-Encoding", "gzip" );
+	fields.add_field( http_field::accept, "text/html" );
+	fields.add_field( "ETag", "12345" );
+
+	REQUIRE( 44 == fields.fields_count() );
+
+	REQUIRE( fields.has_field( http_field::accept ) );
+	REQUIRE( fields.has_field( "accept-encoding" ) );
+	REQUIRE( fields.has_field( "X-CUSTOM-39" ) );
+	REQUIRE_FALSE( fields.has_field( http_field::age ) );
+	REQUIRE_FALSE( fields.has_field( "Age" ) );
+	REQUIRE_FALSE( fields.has_field( "X-Custom-40" ) );
+
+	REQUIRE( "text/plain" == fields.value_of( http_field::accept ) );
+	REQUIRE( "text/plain" == fields.value_of( "Accept" ) );
+	REQUIRE( "gzip" == fields.value_of( http_field::accept_encoding ) );
+	REQUIRE( "12345" == fields.value_of( "etag" ) );
+	REQUIRE( "17" == fields.value_of( "X-Custom-17" ) );
+
+	{
+		std::vector< std::string > values;
+		fields.for_each_value_of( http_field::accept,
+			[&]( auto v ) {
+				values.emplace_back( v.data(), v.size() );
+				return http_header_fields_t::continue_enumeration();
+			} );
+		REQUIRE( std::vector< std::string >{ "text/plain", "text/html" } == values );
+	}
+
+	fields.set_field( http_field::etag, "67890" );
+	REQUIRE( "67890" == fields.value_of( http_field::etag ) );
+	REQUIRE( 44 == fields.fields_count() );
+
+	// The index should be copied.
+	const http_header_fields_t copy{ fields };
+	REQUIRE( "67890" == copy.value_of( http_field::etag ) );
+
+	// The first occurrence is removed, the second one should be found.
+	REQUIRE( fields.remove_field( http_field::accept ) );
+	REQUIRE( "text/html" == fields.value_of( http_field::accept ) );
+	REQUIRE( "gzip" == fields.value_of( http_field::accept_encoding ) );
+
+	REQUIRE( fields.remove_field( "X-Custom-0" ) );
+	REQUIRE( "12345" != fields.value_of( http_field::etag ) );
+	REQUIRE( "67890" == fields.value_of( http_field::etag ) );
+
+	REQUIRE( 1 == fields.remove_all_of( http_field::accept ) );
+	REQUIRE_FALSE( fields.has_field( http_field::accept ) );
+	REQUIRE( "gzip" == fields.value_of( "Accept-Encoding" ) );
+
+	// The copy isn't affected.
+	REQUIRE( "text/plain" == copy.value_of( http_field::accept ) );
+
+	http_header_fields_t small;
+	small.add_field( http_field::age, "1" );
+	small.swap_fields( fields );
+
+	REQUIRE( 1 == fields.fields_count() );
+	REQUIRE( "1" == fields.value_of( http_field::age ) );
+	REQUIRE_FALSE( fields.has_field( http_field::etag ) );
+
+	REQUIRE( "67890" == small.value_of( http_field::etag ) );
+	REQUIRE_FALSE( small.has_field( http_field::age ) );
+}
+
 TEST_CASE( "Connection" , "[header][connection]" )
 {
 	using namespace Catch::Matchers;
@@ -1006,6 +1095,99 @@ TEST_CASE( "Connection" , "[header][connection]" )
 }
 
 
+TEST_CASE( "Prebuilt status lines" , "[header][status_line]" )
+{
+	for( const auto & item : impl::prebuilt_status_lines )
+	{
+		// Reason phrase is taken from the prebuilt line.
+		http_response_header_t h{
+				http_status_line_t{
+					http_status_code_t{ item.m_code },
+					std::string{
+						item.m_line.substr( 13u, item.m_line.size() - 15u ) } } };
+
+		std::string line;
+		impl::append_status_line( line, h );
+
+		REQUIRE( line == item.m_line );
+		REQUIRE( impl::find_prebuilt_status_line( h ) == item.m_line );
+	}
+
+	{
+		http_response_header_t h{ status_ok() };
+		REQUIRE( impl::find_prebuilt_status_line( h ) == "HTTP/1.1 200 OK\r\n" );
+
+		h.reason_phrase( "Fine" );
+		REQUIRE( impl::find_prebuilt_status_line( h ).empty() );
+		REQUIRE_THAT(
+			impl::create_header_string( h ),
+			Catch::Matchers::StartsWith( "HTTP/1.1 200 Fine\r\n" ) );
+	}
+
+	{
+		http_response_header_t h{ status_not_found() };
+		h.http_minor( 0 );
+		REQUIRE( impl::find_prebuilt_status_line( h ).empty() );
+		REQUIRE_THAT(
+			impl::create_header_string( h ),
+			Catch::Matchers::StartsWith( "HTTP/1.0 404 Not Found\r\n" ) );
+	}
+
+	{
+		http_response_header_t h{
+				http_status_line_t{ http_status_code_t{ 299 }, "Custom" } };
+		REQUIRE( impl::find_prebuilt_status_line( h ).empty() );
+		REQUIRE_THAT(
+			impl::create_header_string( h ),
+			Catch::Matchers::StartsWith( "HTTP/1.1 299 Custom\r\n" ) );
+	}
+}
+
+TEST_CASE( "Header template" , "[header][header_template]" )
+{
+	{
+		header_template_t tmpl;
+		REQUIRE( tmpl.empty() );
+		REQUIRE( tmpl.serialized_fields().empty() );
+	}
+
+	{
+		header_template_t tmpl{
+				{ http_field::server, std::string{ "RESTinio" } },
+				{ std::string{ "X-Custom" }, std::string{ "value" } }
+			};
+		REQUIRE( tmpl );
+		REQUIRE( tmpl.serialized_fields() ==
+				"Server: RESTinio\r\n"
+				"X-Custom: value\r\n" );
+
+		const auto item = tmpl.make_writable_item();
+		const auto buf = item.buf();
+		REQUIRE( string_view_t{
+					static_cast< const char * >( buf.data() ), buf.size() } ==
+				"Server: RESTinio\r\n"
+				"X-Custom: value\r\n"
+				"\r\n" );
+	}
+
+	{
+		http_response_header_t h{ status_ok() };
+		h.should_keep_alive( true );
+		h.content_length( 42u );
+		h.set_field( "X-Response", "1" );
+
+		REQUIRE( impl::create_header_string(
+					h,
+					impl::content_length_field_presence_t::add_content_length,
+					0u,
+					impl::final_crlf_presence_t::skip_final_crlf ) ==
+				"HTTP/1.1 200 OK\r\n"
+				"Connection: keep-alive\r\n"
+				"Content-Length: 42\r\n"
+				"X-Response: 1\r\n" );
+	}
+}
+
 TEST_CASE( "Query" , "[header][query string][query path]" )
 {
 	auto append = []( http_request_header_t & h, const std::string & part ){
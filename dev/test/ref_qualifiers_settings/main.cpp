@@ -133,10 +133,19 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 			REQUIRE( std::string{ "127.0.0.1" } ==
 					std::get<std::string>(settings.address()) );
 			REQUIRE( 2017 == settings.buffer_size() );
+			REQUIRE( 512 == settings.initial_buffer_size() );
+			REQUIRE( settings.release_idle_input_buffer() );
+			REQUIRE( settings.try_write_first() );
+			REQUIRE( settings.auto_date_field() );
+			REQUIRE( 65536 == settings.outgoing_data_high_watermark() );
+			REQUIRE( 16384 == settings.outgoing_data_low_watermark() );
+			REQUIRE( settings.request_body_as_rope() );
+			REQUIRE( 32768 == settings.request_body_rope_segment_capacity() );
 			REQUIRE( std::chrono::seconds( 120 ) == settings.read_next_http_message_timelimit() );
 			REQUIRE( std::chrono::seconds( 121 ) == settings.write_http_response_timelimit() );
 			REQUIRE( std::chrono::seconds( 122 ) == settings.handle_request_timeout() );
 			REQUIRE( 42 == settings.max_pipelined_requests() );
+			REQUIRE( 512 == settings.connection_pool_capacity() );
 			REQUIRE( std::string{ "REQUESTHANDLER" } == settings.request_handler()->tag() );
 			REQUIRE( std::string{ "TIMERFACTORY" } == settings.timer_factory()->tag() );
 			REQUIRE( std::string{ "LOGGER" } == settings.logger()->tag() );
@@ -170,6 +179,7 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 
 
 			REQUIRE( settings.separate_accept_and_create_connect() );
+			REQUIRE( 8 == settings.accept_batch_size() );
 		};
 
 	check_params(
@@ -178,10 +188,18 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 			.protocol( restinio::asio_ns::ip::tcp::v6() )
 			.address( "127.0.0.1" )
 			.buffer_size( 2017 )
+			.initial_buffer_size( 512 )
+			.release_idle_input_buffer( true )
+			.try_write_first( true )
+			.auto_date_field( true )
+			.outgoing_data_watermarks( 65536, 16384 )
+			.request_body_as_rope( true )
+			.request_body_rope_segment_capacity( 32768 )
 			.read_next_http_message_timelimit( std::chrono::seconds( 120 ) )
 			.write_http_response_timelimit( std::chrono::seconds( 121 ) )
 			.handle_request_timeout( std::chrono::seconds( 122 ) )
 			.max_pipelined_requests( 42 )
+			.connection_pool_capacity( 512 )
 			.request_handler( "REQUESTHANDLER" )
 			.timer_manager( "TIMERFACTORY" )
 			.logger( "LOGGER" )
@@ -194,5 +212,6 @@ TEST_CASE( "Ref-qualifiers" , "[settings][ref_qualifiers]" )
 				[&]( auto & ){
 					socket_options_lambda_was_called = true;
 				} )
-			.separate_accept_and_create_connect( true ) );
+			.separate_accept_and_create_connect( true )
+			.accept_batch_size( 8 ) );
 }
@@ -0,0 +1,367 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for response cache.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/core.hpp>
+
+#include <test/common/utest_logger.hpp>
+#include <test/common/pub.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace restinio;
+using namespace restinio::tests;
+
+namespace
+{
+
+http_request_header_t
+make_request(
+	http_method_id_t method,
+	std::string target,
+	std::string accept_encoding = std::string{} )
+{
+	http_request_header_t result{ method, std::move( target ) };
+	if( !accept_encoding.empty() )
+		result.set_field( http_field::accept_encoding, std::move( accept_encoding ) );
+
+	return result;
+}
+
+std::string
+to_string( const write_group_t & wg )
+{
+	std::string result;
+	for( const auto & item : wg.items() )
+		result.append(
+				static_cast< const char * >( item.buf().data() ),
+				item.buf().size() );
+
+	return result;
+}
+
+http_header_fields_t
+text_fields()
+{
+	http_header_fields_t fields;
+	fields.add_field( http_field::content_type, std::string{ "text/plain" } );
+	return fields;
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "Serialized cached response" , "[response_cache]" )
+{
+	const cached_response_t response{ status_ok(), text_fields(), "Hello" };
+
+	const auto wg = response.make_write_group(
+			response_connection_attr_t::connection_keepalive );
+	REQUIRE( 15u == wg.status_line_size() );
+	REQUIRE( to_string( wg ) ==
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: keep-alive\r\n"
+			"\r\n"
+			"Hello" );
+
+	REQUIRE( to_string( response.make_write_group(
+				response_connection_attr_t::connection_close ) ) ==
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Content-Length: 5\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"Hello" );
+}
+
+TEST_CASE( "Keys of response cache" , "[response_cache]" )
+{
+	response_cache_t cache{ 64u * 1024u, { "Accept-Encoding" } };
+
+	REQUIRE( cache.store(
+			make_request( http_method_get(), "/a" ),
+			status_ok(), text_fields(), "plain",
+			std::chrono::hours{ 1 } ) );
+	REQUIRE( cache.store(
+			make_request( http_method_get(), "/a", "gzip" ),
+			status_ok(), text_fields(), "gzipped",
+			std::chrono::hours{ 1 } ) );
+
+	REQUIRE_FALSE( cache.find( make_request( http_method_head(), "/a" ) ) );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/b" ) ) );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/a", "br" ) ) );
+
+	auto plain = cache.find( make_request( http_method_get(), "/a" ) );
+	REQUIRE( plain );
+	REQUIRE_THAT( to_string( plain->make_write_group(
+				response_connection_attr_t::connection_close ) ),
+			Catch::Matchers::EndsWith( "\r\n\r\nplain" ) );
+
+	auto gzipped = cache.find( make_request( http_method_get(), "/a", "gzip" ) );
+	REQUIRE( gzipped );
+	REQUIRE_THAT( to_string( gzipped->make_write_group(
+				response_connection_attr_t::connection_close ) ),
+			Catch::Matchers::EndsWith( "\r\n\r\ngzipped" ) );
+
+	// Only GET and HEAD responses are cached.
+	REQUIRE_FALSE( cache.store(
+			make_request( http_method_post(), "/a" ),
+			status_ok(), text_fields(), "posted",
+			std::chrono::hours{ 1 } ) );
+	REQUIRE_FALSE( cache.find( make_request( http_method_post(), "/a" ) ) );
+
+	REQUIRE( cache.store(
+			make_request( http_method_head(), "/a" ),
+			status_ok(), text_fields(), "",
+			std::chrono::hours{ 1 } ) );
+	REQUIRE( cache.find( make_request( http_method_head(), "/a" ) ) );
+
+	// All variants are removed.
+	cache.invalidate( http_method_get(), "/a" );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/a" ) ) );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/a", "gzip" ) ) );
+	REQUIRE( cache.find( make_request( http_method_head(), "/a" ) ) );
+
+	cache.invalidate( http_method_head(), "/a" );
+	REQUIRE( 0u == cache.total_size() );
+}
+
+TEST_CASE( "Expiration of cached responses" , "[response_cache]" )
+{
+	response_cache_t cache{ 64u * 1024u };
+
+	REQUIRE( cache.store(
+			make_request( http_method_get(), "/expired" ),
+			status_ok(), text_fields(), "data",
+			std::chrono::steady_clock::duration::zero() ) );
+	REQUIRE( 0u != cache.total_size() );
+
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/expired" ) ) );
+	REQUIRE( 0u == cache.total_size() );
+}
+
+TEST_CASE( "Size bound of response cache" , "[response_cache]" )
+{
+	const std::string body( 1000u, 'x' );
+	const auto entry_size =
+		cached_response_t{ status_ok(), text_fields(), body }.size();
+
+	response_cache_t cache{ entry_size * 2u };
+
+	REQUIRE_FALSE( cache.store(
+			make_request( http_method_get(), "/too-big" ),
+			status_ok(), text_fields(), body + body + body,
+			std::chrono::hours{ 1 } ) );
+
+	const auto store = [&]( std::string target ) {
+		return cache.store(
+				make_request( http_method_get(), std::move( target ) ),
+				status_ok(), text_fields(), body,
+				std::chrono::hours{ 1 } );
+	};
+
+	REQUIRE( store( "/1" ) );
+	REQUIRE( store( "/2" ) );
+
+	// "/1" gets a second chance because it's used.
+	REQUIRE( cache.find( make_request( http_method_get(), "/1" ) ) );
+
+	REQUIRE( store( "/3" ) );
+	REQUIRE( entry_size * 2u == cache.total_size() );
+
+	REQUIRE( cache.find( make_request( http_method_get(), "/1" ) ) );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/2" ) ) );
+	REQUIRE( cache.find( make_request( http_method_get(), "/3" ) ) );
+
+	// Replacement of an existing response.
+	REQUIRE( store( "/3" ) );
+	REQUIRE( entry_size * 2u == cache.total_size() );
+
+	cache.clear();
+	REQUIRE( 0u == cache.total_size() );
+	REQUIRE_FALSE( cache.find( make_request( http_method_get(), "/1" ) ) );
+}
+
+TEST_CASE( "Cache hits bypass request handler" , "[response_cache][server]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	auto cache = std::make_shared< response_cache_t >( 64u * 1024u );
+	std::atomic< int > handler_calls{ 0 };
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.response_cache( cache )
+				.request_handler( [&]( auto req ) {
+						++handler_calls;
+
+						const std::string body{ "Cached content" };
+						cache->store(
+								req->header(),
+								status_ok(),
+								text_fields(),
+								body,
+								std::chrono::hours{ 1 } );
+
+						return req->create_response()
+							.append_header( http_field::content_type, "text/plain" )
+							.set_body( body )
+							.done();
+					} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	const std::string request{
+			"GET /data HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Connection: close\r\n"
+			"\r\n" };
+
+	std::string first_response;
+	REQUIRE_NOTHROW( first_response = do_request(
+			request, default_ip_addr(), port_getter.port() ) );
+	REQUIRE_THAT( first_response,
+			Catch::Matchers::EndsWith( "\r\n\r\nCached content" ) );
+
+	std::string second_response;
+	REQUIRE_NOTHROW( second_response = do_request(
+			request, default_ip_addr(), port_getter.port() ) );
+	REQUIRE( second_response ==
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Content-Length: 14\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"Cached content" );
+
+	// Pipelined requests are served from the cache too.
+	std::string pipelined_responses;
+	REQUIRE_NOTHROW( pipelined_responses = do_request(
+			"GET /data HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"\r\n" + request,
+			default_ip_addr(), port_getter.port() ) );
+	REQUIRE_THAT( pipelined_responses,
+			Catch::Matchers::StartsWith(
+				"HTTP/1.1 200 OK\r\n"
+				"Content-Type: text/plain\r\n"
+				"Content-Length: 14\r\n"
+				"Connection: keep-alive\r\n"
+				"\r\n"
+				"Cached content"
+				"HTTP/1.1 200 OK\r\n" ) );
+
+	other_thread.stop_and_join();
+
+	REQUIRE( 1 == handler_calls );
+}
+
+TEST_CASE( "Cache hits with outgoing data watermarks" , "[response_cache][server][watermarks]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	auto cache = std::make_shared< response_cache_t >( 64u * 1024u );
+	cache->store(
+			make_request( http_method_get(), "/data" ),
+			status_ok(),
+			text_fields(),
+			std::string{ "Cached content" },
+			std::chrono::hours{ 1 } );
+
+	random_port_getter_t port_getter;
+
+	http_server_t http_server{
+		restinio::own_io_context(),
+		[&]( auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.response_cache( cache )
+				.outgoing_data_watermarks( 1024u, 256u )
+				.request_handler( [&]( auto req ) {
+						auto resp = req->template create_response<
+								restinio::chunked_output_t >();
+						resp.connection_close();
+
+						// Data of the cached response is already written,
+						// so the output has to be writable.
+						resp.append_chunk( resp.output_is_writable() ?
+								std::string{ "writable" } :
+								std::string{ "not writable" } );
+
+						return resp.done();
+					} );
+		}
+	};
+
+	other_work_thread_for_server_t<http_server_t> other_thread(http_server);
+	other_thread.run();
+
+	std::string second_response;
+	REQUIRE_NOTHROW( do_with_socket(
+		[&]( auto & socket, auto & /*io_context*/ ) {
+			restinio::asio_ns::write( socket, restinio::asio_ns::buffer(
+					std::string{
+						"GET /data HTTP/1.1\r\n"
+						"Host: 127.0.0.1\r\n"
+						"\r\n" } ) );
+
+			restinio::asio_ns::streambuf first_response;
+			restinio::asio_ns::read_until(
+					socket, first_response, "Cached content" );
+
+			restinio::asio_ns::write( socket, restinio::asio_ns::buffer(
+					std::string{
+						"GET /state HTTP/1.1\r\n"
+						"Host: 127.0.0.1\r\n"
+						"Connection: close\r\n"
+						"\r\n" } ) );
+
+			restinio::asio_ns::streambuf response_stream;
+			restinio::asio_ns::error_code error;
+			while( restinio::asio_ns::read(
+					socket,
+					response_stream,
+					restinio::asio_ns::transfer_at_least( 1 ),
+					error ) )
+			{}
+
+			second_response.assign(
+					restinio::asio_ns::buffers_begin( response_stream.data() ),
+					restinio::asio_ns::buffers_end( response_stream.data() ) );
+		},
+		default_ip_addr(),
+		port_getter.port() ) );
+
+	other_thread.stop_and_join();
+
+	REQUIRE_THAT( second_response,
+			Catch::Matchers::EndsWith( "\r\n8\r\nwritable\r\n0\r\n\r\n" ) );
+}
@@ -1793,3 +1793,74 @@ TEST_CASE( "response_coordinator reset" , "[response_coordinator][connection_clo
 		coordinator.reset();
 	}
 }
+
+TEST_CASE( "response_coordinator pop ready trivial buffers" , "[response_coordinator][coalescing]" )
+{
+	response_coordinator_t coordinator{ 4 };
+
+	request_id_t req_id[ 4 ];
+	for( auto & id : req_id )
+		id = coordinator.register_new_request();
+
+	// #0: ("a", "b") complete
+	// #1: ("c") complete
+	// #2: sendfile complete
+	// #3: ("d") complete, connection close
+	coordinator.append_response(
+		req_id[ 0 ],
+		response_output_flags_t{
+			response_is_complete(),
+			connection_should_keep_alive() },
+		write_group_t{ make_buffers( { "a", "b" } ) } );
+	coordinator.append_response(
+		req_id[ 1 ],
+		response_output_flags_t{
+			response_is_complete(),
+			connection_should_keep_alive() },
+		write_group_t{ make_buffers( { "c" } ) } );
+	coordinator.append_response(
+		req_id[ 2 ],
+		response_output_flags_t{
+			response_is_complete(),
+			connection_should_keep_alive() },
+		write_group_t{ make_buffers( restinio::sendfile(
+			restinio::null_file_descriptor() /* fake not real */,
+			restinio::file_meta_t{ 1024, std::chrono::system_clock::now() } ) ) } );
+	coordinator.append_response(
+		req_id[ 3 ],
+		response_output_flags_t{
+			response_is_complete(),
+			connection_should_close() },
+		write_group_t{ make_buffers( { "d" } ) } );
+
+	// The limit on items count.
+	REQUIRE_FALSE( coordinator.pop_ready_trivial_buffers( 1u, 1024u ) );
+
+	// The limit on total size.
+	REQUIRE_FALSE( coordinator.pop_ready_trivial_buffers( 16u, 1u ) );
+
+	auto popped_wg = coordinator.pop_ready_trivial_buffers( 16u, 1024u );
+	REQUIRE( popped_wg );
+	REQUIRE( req_id[ 0 ] == popped_wg->second );
+	REQUIRE( "ab" == concat_bufs( popped_wg->first ) );
+
+	popped_wg = coordinator.pop_ready_trivial_buffers( 16u, 1024u );
+	REQUIRE( popped_wg );
+	REQUIRE( req_id[ 1 ] == popped_wg->second );
+	REQUIRE( "c" == concat_bufs( popped_wg->first ) );
+
+	// Sendfile can't be coalesced.
+	REQUIRE_FALSE( coordinator.pop_ready_trivial_buffers( 16u, 1024u ) );
+
+	popped_wg = coordinator.pop_ready_buffers();
+	REQUIRE( popped_wg );
+	REQUIRE( req_id[ 2 ] == popped_wg->second );
+
+	popped_wg = coordinator.pop_ready_trivial_buffers( 16u, 1024u );
+	REQUIRE( popped_wg );
+	REQUIRE( req_id[ 3 ] == popped_wg->second );
+	REQUIRE( coordinator.closed() );
+
+	// Closed coordinator doesn't throw.
+	REQUIRE_FALSE( coordinator.pop_ready_trivial_buffers( 16u, 1024u ) );
+}
@@ -527,6 +527,48 @@ tc_http_method_matchers()
 			create_fake_request( router, "/user", http_method_put() ) ) );
 		REQUIRE( http_method_put() == extract_last_http_method() );
 	}
+
+	SECTION( "order of routes with different matchers" )
+	{
+		Router router;
+
+		int last_handler_called = -1;
+
+		router.http_get( epr::path_to_params( "/user" ), [&]( const auto & ){
+				last_handler_called = 0;
+				return request_accepted();
+			} );
+
+		router.add_handler(
+			restinio::router::none_of_methods( http_method_get() ),
+			epr::path_to_params( "/user" ),
+			[&]( const auto & ){
+				last_handler_called = 1;
+				return request_accepted();
+			} );
+
+		router.http_delete( epr::path_to_params( "/user" ), [&]( const auto & ){
+				last_handler_called = 2;
+				return request_accepted();
+			} );
+
+		router.http_post( epr::path_to_params( "/item" ), [&]( const auto & ){
+				last_handler_called = 3;
+				return request_accepted();
+			} );
+
+		const auto check = [&]( http_method_id_t method, std::string path ) {
+			last_handler_called = -1;
+			(void)router( create_fake_request( router, std::move(path), method ) );
+			return last_handler_called;
+		};
+
+		REQUIRE( 0 == check( http_method_get(), "/user" ) );
+		REQUIRE( 1 == check( http_method_delete(), "/user" ) );
+		REQUIRE( 1 == check( http_method_put(), "/user" ) );
+		REQUIRE( 3 == check( http_method_post(), "/item" ) );
+		REQUIRE( -1 == check( http_method_get(), "/item" ) );
+	}
 }
 
 TEST_CASE( "Http method matchers (no_user_data)" ,
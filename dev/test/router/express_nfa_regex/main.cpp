@@ -0,0 +1,141 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for express router engine.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <iterator>
+
+#include <restinio/core.hpp>
+
+#include "usings.ipp"
+
+#include "../express/additional_tests.ipp"
+
+#include <regex>
+
+namespace
+{
+
+using restinio::router::impl::nfa_regex::regex_t;
+using restinio::router::impl::nfa_regex::match_results_t;
+
+// Results of std::regex in the form of nfa_regex.
+bool
+std_regex_search(
+	const std::string & pattern,
+	bool icase,
+	const std::string & text,
+	match_results_t & results )
+{
+	auto flags = std::regex::ECMAScript;
+	if( icase )
+		flags |= std::regex::icase;
+
+	std::smatch m;
+	if( !std::regex_search( text, m, std::regex{ pattern, flags } ) )
+		return false;
+
+	for( std::size_t i = 0u; i != m.size(); ++i )
+	{
+		if( m[ i ].matched )
+			results.emplace_back(
+				static_cast< std::size_t >( m.position( i ) ),
+				static_cast< std::size_t >( m.position( i ) + m.length( i ) ) );
+		else
+			results.emplace_back( 0u, 0u );
+	}
+
+	return true;
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "NFA regex: same results as std::regex" , "[nfa_regex][std_regex]" )
+{
+	const std::vector< std::string > patterns{
+		R"(^\/(\d+))",
+		R"(^\/([^\/]+?)(?:\/)?$)",
+		R"(^\/([^\/]+?)(?=\/|$))",
+		R"(^\/test(?:\/)?(?=$))",
+		R"(^\/(?:([^\/]+?))?(?:\/)?$)",
+		R"(^\/((?:[^\/]+?)(?:\/(?:[^\/]+?))*)(?:\/)?$)",
+		R"(^\/(video|audio|text)(\+.+)?$)",
+		R"(^\/(\d{2}\.[AB]{0,2})\/([a-z]?)$)",
+		R"(^\/(\d{4})-(\d{2})-(\d{2})$)",
+		R"(^\/([\w\-\.]+)\/([\w\-]+)$)",
+		R"(^\/(a|ab)(c|bcd)(d*)$)",
+		R"(^(a+?)(a*)$)",
+		R"(^(?:x|(y))+$)",
+		R"(\bword\b)",
+		R"(^[^a-c]+$)",
+		R"(^\/(?!admin)([a-z]+)$)",
+		R"(\d+)",
+		R"(^[\]\-]+$)",
+		R"(^a{2,}b{0,2}$)"
+	};
+
+	const std::vector< std::string > texts{
+		"", "/", "/42", "/42/", "/abc", "/abc/", "/abc/def", "/a/b/c/",
+		"/test", "/test/", "/TEST", "/video", "/audio+mp4", "/12.AB/q",
+		"/12.A/", "/2024-01-31", "/user-1/repo.x", "/abcd", "/abcbcd",
+		"aaa", "aab", "ab", "xyxy", "xx", "a word here", "words",
+		"def", "/admin", "/admins", "/user", "x123y", "]-]", "aabb", "aab{,2}",
+		"aaab{,2}"
+	};
+
+	for( const bool icase : { false, true } )
+		for( const auto & p : patterns )
+		{
+			const regex_t regex{ p, icase };
+			for( const auto & t : texts )
+			{
+				match_results_t expected;
+				const bool expected_result = std_regex_search( p, icase, t, expected );
+
+				match_results_t actual;
+				const bool actual_result = regex.search( t, actual );
+
+				INFO( "pattern: " << p << ", text: '" << t << "', icase: " << icase );
+				REQUIRE( expected_result == actual_result );
+				if( expected_result )
+				{
+					REQUIRE( expected.size() == actual.size() );
+					for( std::size_t i = 0u; i != expected.size(); ++i )
+					{
+						INFO( "group: " << i );
+						REQUIRE( expected[ i ] == actual[ i ] );
+					}
+				}
+			}
+		}
+}
+
+TEST_CASE( "NFA regex: unsupported constructs" , "[nfa_regex][errors]" )
+{
+	REQUIRE_THROWS_AS( regex_t( R"((a)\1)", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"((?<=a)b)", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"((a)", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"(a))", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"([a)", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"(*a)", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"(a{3,2})", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"(a{1,100000})", false ), restinio::exception_t );
+	REQUIRE_THROWS_AS( regex_t( R"(a\)", false ), restinio::exception_t );
+}
+
+TEST_CASE( "NFA regex: long input" , "[nfa_regex][linear]" )
+{
+	// A pattern that takes exponential time with a naive backtracking.
+	const regex_t regex{ R"(^(a|a)*(a|a)*b$)", false };
+
+	match_results_t results;
+	REQUIRE_FALSE( regex.search( std::string( 10000u, 'a' ), results ) );
+	REQUIRE( regex.search( std::string( 10000u, 'a' ) + "b", results ) );
+	REQUIRE( 3u == results.size() );
+	REQUIRE( 10001u == results[ 0 ].second );
+}
@@ -0,0 +1,9 @@
+#include <catch2/catch_all.hpp>
+
+#include <iterator>
+
+#include <restinio/core.hpp>
+
+#include "usings.ipp"
+
+#include "../express/original_tests_part2.ipp"
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <restinio/router/nfa_regex_engine.hpp>
+
+using regex_engine_t = restinio::router::nfa_regex_engine_t;
+using route_matcher_t = restinio::router::impl::route_matcher_t< regex_engine_t >;
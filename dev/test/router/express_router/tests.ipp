@@ -1,3 +1,5 @@
+#include <restinio/router/single_pass_express.hpp>
+
 #include "../../common/fake_connection.ipp"
 
 template< typename Regex_Engine, typename Extra_Data_Factory >
@@ -23,6 +25,52 @@ create_fake_request(
 			extra_data_factory );
 }
 
+template< typename Regex_Engine, typename Extra_Data_Factory >
+auto
+create_fake_request(
+	const restinio::router::generic_radix_express_router_t<Regex_Engine, Extra_Data_Factory> &,
+	std::string target,
+	http_method_id_t method = http_method_get() )
+{
+	using request_t = restinio::generic_request_t<
+			typename Extra_Data_Factory::data_t
+	>;
+
+	Extra_Data_Factory extra_data_factory;
+	return std::make_shared< request_t >(
+			0,
+			http_request_header_t{ method, std::move( target ) },
+			"",
+			std::make_shared< fake_connection_t >(),
+			restinio::endpoint_t{
+				restinio::asio_ns::ip::make_address_v4("127.0.0.1"),
+				3000 },
+			extra_data_factory );
+}
+
+template< typename Extra_Data_Factory >
+auto
+create_fake_request(
+	const restinio::router::generic_single_pass_express_router_t<Extra_Data_Factory> &,
+	std::string target,
+	http_method_id_t method = http_method_get() )
+{
+	using request_t = restinio::generic_request_t<
+			typename Extra_Data_Factory::data_t
+	>;
+
+	Extra_Data_Factory extra_data_factory;
+	return std::make_shared< request_t >(
+			0,
+			http_request_header_t{ method, std::move( target ) },
+			"",
+			std::make_shared< fake_connection_t >(),
+			restinio::endpoint_t{
+				restinio::asio_ns::ip::make_address_v4("127.0.0.1"),
+				3000 },
+			extra_data_factory );
+}
+
 TEST_CASE( "Simple named param" , "[express][simple][named_params]" )
 {
 
@@ -532,6 +580,70 @@ TEST_CASE( "Http method matchers" , "[express][http_method_matchers]" )
 			create_fake_request( router, "/user", http_method_put() ) ) );
 		REQUIRE( http_method_put() == extract_last_http_method() );
 	}
+
+	SECTION( "order of routes with different matchers" )
+	{
+		express_router_t router;
+
+		int last_handler_called = -1;
+
+		router.http_get( "/user/:id", [&]( const auto &, auto ){
+				last_handler_called = 0;
+				return request_accepted();
+			} );
+
+		router.add_handler(
+			restinio::router::none_of_methods( http_method_get() ),
+			"/user/:id",
+			[&]( const auto &, auto ){
+				last_handler_called = 1;
+				return request_accepted();
+			} );
+
+		router.add_handler(
+			restinio::router::any_of_methods(
+				http_method_get(),
+				http_method_post(),
+				http_method_post() ),
+			"/user/:id",
+			[&]( const auto &, auto ){
+				last_handler_called = 2;
+				return request_accepted();
+			} );
+
+		router.http_delete( "/user/:id", [&]( const auto &, auto ){
+				last_handler_called = 3;
+				return request_accepted();
+			} );
+
+		router.add_handler(
+			restinio::router::none_of_methods( http_method_post() ),
+			"/item/:id",
+			[&]( const auto &, auto ){
+				last_handler_called = 4;
+				return request_accepted();
+			} );
+
+		router.http_post( "/item/:id", [&]( const auto &, auto ){
+				last_handler_called = 5;
+				return request_accepted();
+			} );
+
+		const auto check = [&]( http_method_id_t method, std::string path ) {
+			last_handler_called = -1;
+			(void)router( create_fake_request( router, std::move(path), method ) );
+			return last_handler_called;
+		};
+
+		REQUIRE( 0 == check( http_method_get(), "/user/1" ) );
+		REQUIRE( 1 == check( http_method_post(), "/user/1" ) );
+		REQUIRE( 1 == check( http_method_delete(), "/user/1" ) );
+		REQUIRE( 1 == check( http_method_put(), "/user/1" ) );
+		REQUIRE( 4 == check( http_method_get(), "/item/1" ) );
+		REQUIRE( 4 == check( http_method_delete(), "/item/1" ) );
+		REQUIRE( 5 == check( http_method_post(), "/item/1" ) );
+		REQUIRE( -1 == check( http_method_post(), "/unknown" ) );
+	}
 }
 
 TEST_CASE( "Many params" , "[express][named_params][indexed_params]" )
@@ -1016,3 +1128,61 @@ TEST_CASE( "Parameters cast" , "[express][parameters_cast]" )
 		REQUIRE_THROWS( restinio::cast_to< int_type_t >( route_params[ 0 ] ) );
 	}
 }
+
+TEST_CASE( "Route params lifetime" , "[express][route_params][lifetime]" )
+{
+	route_params_t route_params{};
+
+	express_router_t router;
+
+	router.http_get(
+		"/:p1/:p2/:p3/:p4/:p5/:p6/:p7/:p8/:p9/:p10",
+		[&]( auto , auto p ){
+			route_params = std::move( p );
+			return request_accepted();
+		} );
+
+	router.http_get(
+		R"(/single/(.*))",
+		[&]( auto , auto p ){
+			route_params = std::move( p );
+			return request_accepted();
+		} );
+
+	SECTION( "request target isn't normalized" )
+	{
+		// The request object is destroyed right after the call.
+		REQUIRE( request_accepted() == router(
+				create_fake_request( router, "/single/value" ) ) );
+
+		REQUIRE( 1u == route_params.indexed_parameters_size() );
+		REQUIRE( route_params[ 0 ] == "value" );
+		REQUIRE( route_params.match() == "/single/value" );
+	}
+
+	SECTION( "request target is normalized" )
+	{
+		REQUIRE( request_accepted() == router(
+				create_fake_request( router, "/single/%41%42%43" ) ) );
+
+		REQUIRE( 1u == route_params.indexed_parameters_size() );
+		REQUIRE( route_params[ 0 ] == "ABC" );
+	}
+
+	SECTION( "more params than stored inline" )
+	{
+		REQUIRE( request_accepted() == router(
+				create_fake_request( router, "/a/b/c/d/e/f/g/h/i/j" ) ) );
+
+		REQUIRE( 10u == route_params.named_parameters_size() );
+		REQUIRE( route_params[ "p1" ] == "a" );
+		REQUIRE( route_params[ "p8" ] == "h" );
+		REQUIRE( route_params[ "p9" ] == "i" );
+		REQUIRE( route_params[ "p10" ] == "j" );
+
+		// Params remain valid after a move.
+		route_params_t moved{ std::move( route_params ) };
+		REQUIRE( moved[ "p1" ] == "a" );
+		REQUIRE( moved[ "p10" ] == "j" );
+	}
+}
@@ -0,0 +1,7 @@
+#include <restinio/core.hpp>
+#include <restinio/router/nfa_regex_engine.hpp>
+
+#define RESTINIO_EXPRESS_ROUTER_BENCH_APP_TITLE "Express router (nfa regex engine) benchmark"
+#define RESTINIO_EXPRESS_ROUTER_BENCH_REGEX_ENGINE restinio::router::nfa_regex_engine_t
+
+#include "../express_router_bench/main.cpp"
@@ -0,0 +1,143 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for prefix tree based express router.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <iterator>
+
+#include <restinio/core.hpp>
+
+using namespace restinio;
+
+using express_router_t = restinio::router::radix_express_router_t<>;
+using restinio::router::route_params_t;
+
+#include "../express_router/tests.ipp"
+
+namespace
+{
+
+struct route_description_t
+{
+	http_method_id_t m_method;
+	std::string m_route;
+	restinio::path2regex::options_t m_options;
+};
+
+struct match_result_t
+{
+	int m_handler{ -1 };
+	std::string m_match;
+	std::vector< std::pair< std::string, std::string > > m_named;
+	std::vector< std::string > m_indexed;
+
+	bool
+	operator==( const match_result_t & o ) const
+	{
+		return m_handler == o.m_handler &&
+				m_match == o.m_match &&
+				m_named == o.m_named &&
+				m_indexed == o.m_indexed;
+	}
+};
+
+template< typename Router >
+void
+fill_router(
+	Router & router,
+	const std::vector< route_description_t > & routes,
+	match_result_t & result )
+{
+	for( std::size_t i = 0; i != routes.size(); ++i )
+	{
+		router.add_handler(
+			routes[ i ].m_method,
+			routes[ i ].m_route,
+			routes[ i ].m_options,
+			[&result, i]( auto, route_params_t p ) {
+				using accessor_t = restinio::router::impl::route_params_accessor_t;
+
+				result.m_handler = static_cast< int >( i );
+				result.m_match = std::string{ p.match() };
+				for( const auto & np : accessor_t::named_parameters( p ) )
+					result.m_named.emplace_back(
+							std::string{ np.first }, std::string{ np.second } );
+				for( const auto & ip : accessor_t::indexed_parameters( p ) )
+					result.m_indexed.emplace_back( ip );
+
+				return request_accepted();
+			} );
+	}
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "Same results as express router" , "[radix_express][compatibility]" )
+{
+	using namespace restinio::path2regex;
+
+	const std::vector< route_description_t > routes{
+		{ http_method_get(), "/", options_t{} },
+		{ http_method_get(), "/api/v1/users", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id", options_t{} },
+		{ http_method_post(), "/api/v1/users/:id", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id/posts/:post", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id(\\d+)/avatar", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id/avatar", options_t{} },
+		{ http_method_get(), "/api/v1/Sensitive/:id", options_t{}.sensitive( true ) },
+		{ http_method_get(), "/api/v1/strict/", options_t{}.strict( true ) },
+		{ http_method_get(), "/api/v1/prefix", options_t{}.ending( false ) },
+		{ http_method_get(), "/api/v2/:name.:ext", options_t{} },
+		{ http_method_get(), "/api/v2/:opt?", options_t{} },
+		{ http_method_get(), "/api/v2/files/:path+", options_t{} },
+		{ http_method_get(), "/api/v2/(\\d+)/:x", options_t{} },
+		{ http_method_get(), "/api/v3-:kind", options_t{} },
+		{ http_method_get(), "/:any", options_t{} },
+		{ http_method_get(), "/static/file.txt", options_t{} },
+	};
+
+	const std::vector< std::string > paths{
+		"", "/", "//", "/api", "/api/v1/users", "/API/V1/USERS", "/api/v1/users/",
+		"/api/v1/users//", "/api/v1/users/42", "/api/v1/users/42/",
+		"/api/v1/users/42/posts/7", "/api/v1/users/42/posts/7/",
+		"/api/v1/users/42/posts/", "/api/v1/users/42/avatar",
+		"/api/v1/users/abc/avatar", "/api/v1/Sensitive/1",
+		"/api/v1/sensitive/1", "/api/v1/strict/", "/api/v1/strict",
+		"/api/v1/prefix", "/api/v1/prefix/more", "/api/v1/prefixmore",
+		"/api/v2/report.pdf", "/api/v2/a.b.c", "/api/v2", "/api/v2/x",
+		"/api/v2/files/a/b/c", "/api/v2/123/y", "/api/v3-kind",
+		"/anything", "/anything/else", "/static/file.txt",
+		"/static/file.txt/", "/static/FILE.TXT", "/%7Euser",
+	};
+
+	restinio::router::express_router_t<> linear_router;
+	restinio::router::radix_express_router_t<> radix_router;
+
+	match_result_t linear_result;
+	match_result_t radix_result;
+
+	fill_router( linear_router, routes, linear_result );
+	fill_router( radix_router, routes, radix_result );
+
+	for( const auto method : { http_method_get(), http_method_post() } )
+		for( const auto & path : paths )
+		{
+			INFO( "path: '" << path << "', method: " << method.c_str() );
+
+			linear_result = match_result_t{};
+			radix_result = match_result_t{};
+
+			const auto linear_status = linear_router(
+					create_fake_request( linear_router, path, method ) );
+			const auto radix_status = radix_router(
+					create_fake_request( radix_router, path, method ) );
+
+			REQUIRE( linear_status == radix_status );
+			REQUIRE( linear_result == radix_result );
+		}
+}
@@ -0,0 +1,189 @@
+/*
+	restinio
+*/
+
+/*!
+	Comparison of regex engines for express router.
+
+	Every engine is used for the same set of routes and the same set of
+	request targets. Requests are dispatched in the current thread without
+	any networking, so only the time spent in the router is measured.
+*/
+
+#include <chrono>
+#include <iostream>
+
+#include <restinio/core.hpp>
+#include <restinio/router/nfa_regex_engine.hpp>
+#include <restinio/router/single_pass_express.hpp>
+
+#if defined( RESTINIO_REGEX_ENGINES_BENCH_WITH_PCRE2 )
+	#include <restinio/router/pcre2_regex_engine.hpp>
+#endif
+
+#if defined( RESTINIO_REGEX_ENGINES_BENCH_WITH_BOOST_REGEX )
+	#include <restinio/router/boost_regex_engine.hpp>
+#endif
+
+#include <fmt/format.h>
+
+#include <restinio-helpers/cmd_line_args_helpers.hpp>
+
+#include "../../common/fake_connection.ipp"
+
+struct app_args_t
+{
+	bool m_help{ false };
+
+	std::size_t m_iterations{ 100000 };
+
+	static app_args_t
+	parse( int argc, const char * argv[] )
+	{
+		app_args_t result;
+
+		using namespace restinio_helpers;
+
+		process_cmd_line_args( argc, argv, result,
+				cmd_line_arg_t{
+						result.m_iterations,
+						"-i", "--iterations",
+						"count of passes through all request targets (default: {})"
+					} );
+
+		return result;
+	}
+};
+
+struct route_t
+{
+	restinio::http_method_id_t m_method;
+	const char * m_route;
+};
+
+// Routes similar to routes of a typical REST API.
+const route_t routes[] = {
+	{ restinio::http_method_get(), "/" },
+	{ restinio::http_method_get(), "/users" },
+	{ restinio::http_method_post(), "/users" },
+	{ restinio::http_method_get(), "/users/:user" },
+	{ restinio::http_method_put(), "/users/:user" },
+	{ restinio::http_method_delete(), "/users/:user" },
+	{ restinio::http_method_get(), "/users/:user/repos" },
+	{ restinio::http_method_get(), "/users/:user/followers" },
+	{ restinio::http_method_get(), "/users/:user/following/:target" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/commits" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/commits/:sha([0-9a-f]{7,40})" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/issues" },
+	{ restinio::http_method_post(), "/repos/:owner/:repo/issues" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/issues/:number(\\d+)" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/issues/:number(\\d+)/comments" },
+	{ restinio::http_method_get(), "/repos/:owner/:repo/pulls/:number(\\d+)/files" },
+	{ restinio::http_method_get(), "/events/:year(\\d{4})-:month(\\d{2})-:day(\\d{2})" },
+	{ restinio::http_method_get(), "/search/:kind(code|issues|users)" },
+	{ restinio::http_method_get(), "/static/:path(.*)" },
+};
+
+const char * targets[] = {
+	"/",
+	"/users",
+	"/users/octocat",
+	"/users/octocat/repos",
+	"/users/octocat/following/torvalds",
+	"/repos/stiffstream/restinio",
+	"/repos/stiffstream/restinio/commits/0754d81",
+	"/repos/stiffstream/restinio/issues/42/comments",
+	"/repos/stiffstream/restinio/pulls/128/files",
+	"/events/2024-01-31",
+	"/search/issues",
+	"/static/css/main.css",
+	"/no/such/route",
+	"/repos/stiffstream/restinio/issues/not-a-number",
+};
+
+template< typename Router >
+auto
+make_request( const Router &, const char * target )
+{
+	using request_t = restinio::generic_request_t<
+			restinio::no_extra_data_factory_t::data_t >;
+
+	restinio::no_extra_data_factory_t extra_data_factory;
+	return std::make_shared< request_t >(
+			0,
+			restinio::http_request_header_t{ restinio::http_method_get(), target },
+			"",
+			std::make_shared< fake_connection_t >(),
+			restinio::endpoint_t{
+				restinio::asio_ns::ip::make_address_v4( "127.0.0.1" ),
+				3000 },
+			extra_data_factory );
+}
+
+template< typename Router >
+void
+run_bench( const char * engine_name, const app_args_t & args )
+{
+	Router router;
+	for( const auto & r : routes )
+		router.add_handler( r.m_method, r.m_route,
+			[]( const auto &, const auto & ) {
+				return restinio::request_accepted();
+			} );
+
+	std::vector< restinio::request_handle_t > requests;
+	for( const auto * t : targets )
+		requests.push_back( make_request( router, t ) );
+
+	std::size_t accepted = 0u;
+	const auto started_at = std::chrono::steady_clock::now();
+
+	for( std::size_t i = 0u; i != args.m_iterations; ++i )
+		for( const auto & req : requests )
+			if( restinio::request_accepted() == router( req ) )
+				++accepted;
+
+	const auto duration = std::chrono::duration_cast< std::chrono::nanoseconds >(
+			std::chrono::steady_clock::now() - started_at );
+	const auto total = args.m_iterations * requests.size();
+
+	std::cout << fmt::format(
+			RESTINIO_FMT_FORMAT_STRING(
+				"{:<18} {:>10.1f} ns/request ({} requests, {} accepted)" ),
+			engine_name,
+			static_cast< double >( duration.count() ) / static_cast< double >( total ),
+			total,
+			accepted ) << std::endl;
+}
+
+int
+main( int argc, const char *argv[] )
+{
+	try
+	{
+		const auto args = app_args_t::parse( argc, argv );
+
+		if( !args.m_help )
+		{
+			using namespace restinio::router;
+
+			run_bench< express_router_t< std_regex_engine_t > >( "std::regex", args );
+			run_bench< express_router_t< nfa_regex_engine_t > >( "nfa", args );
+			run_bench< single_pass_express_router_t >( "nfa (single pass)", args );
+#if defined( RESTINIO_REGEX_ENGINES_BENCH_WITH_PCRE2 )
+			run_bench< express_router_t< pcre2_regex_engine_t<> > >( "pcre2", args );
+#endif
+#if defined( RESTINIO_REGEX_ENGINES_BENCH_WITH_BOOST_REGEX )
+			run_bench< express_router_t< boost_regex_engine_t > >( "boost::regex", args );
+#endif
+		}
+	}
+	catch( const std::exception & ex )
+	{
+		std::cerr << "Error: " << ex.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,240 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for single pass express router.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <iterator>
+
+#include <restinio/core.hpp>
+#include <restinio/router/single_pass_express.hpp>
+
+using namespace restinio;
+
+using express_router_t = restinio::router::single_pass_express_router_t;
+using restinio::router::route_params_t;
+
+#include "../express_router/tests.ipp"
+
+namespace
+{
+
+struct route_description_t
+{
+	http_method_id_t m_method;
+	std::string m_route;
+	restinio::path2regex::options_t m_options;
+};
+
+struct match_result_t
+{
+	int m_handler{ -1 };
+	std::string m_match;
+	std::vector< std::pair< std::string, std::string > > m_named;
+	std::vector< std::string > m_indexed;
+
+	bool
+	operator==( const match_result_t & o ) const
+	{
+		return m_handler == o.m_handler &&
+				m_match == o.m_match &&
+				m_named == o.m_named &&
+				m_indexed == o.m_indexed;
+	}
+};
+
+template< typename Router >
+void
+fill_router(
+	Router & router,
+	const std::vector< route_description_t > & routes,
+	match_result_t & result )
+{
+	for( std::size_t i = 0; i != routes.size(); ++i )
+	{
+		router.add_handler(
+			routes[ i ].m_method,
+			routes[ i ].m_route,
+			routes[ i ].m_options,
+			[&result, i]( auto, route_params_t p ) {
+				using accessor_t = restinio::router::impl::route_params_accessor_t;
+
+				result.m_handler = static_cast< int >( i );
+				result.m_match = std::string{ p.match() };
+				for( const auto & np : accessor_t::named_parameters( p ) )
+					result.m_named.emplace_back(
+							std::string{ np.first }, std::string{ np.second } );
+				for( const auto & ip : accessor_t::indexed_parameters( p ) )
+					result.m_indexed.emplace_back( ip );
+
+				return request_accepted();
+			} );
+	}
+}
+
+} /* anonymous namespace */
+
+TEST_CASE( "Same results as express router" , "[single_pass_express][compatibility]" )
+{
+	using namespace restinio::path2regex;
+
+	const std::vector< route_description_t > routes{
+		{ http_method_get(), "/", options_t{} },
+		{ http_method_get(), "/api/v1/users", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id", options_t{} },
+		{ http_method_post(), "/api/v1/users/:id", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id/posts/:post", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id(\\d+)/avatar", options_t{} },
+		{ http_method_get(), "/api/v1/users/:id/avatar", options_t{} },
+		{ http_method_get(), "/api/v1/Sensitive/:id", options_t{}.sensitive( true ) },
+		{ http_method_get(), "/api/v1/strict/", options_t{}.strict( true ) },
+		{ http_method_get(), "/api/v1/prefix", options_t{}.ending( false ) },
+		{ http_method_get(), "/api/v2/:name.:ext", options_t{} },
+		{ http_method_get(), "/api/v2/:opt?", options_t{} },
+		{ http_method_get(), "/api/v2/files/:path+", options_t{} },
+		{ http_method_get(), "/api/v2/(\\d+)/:x", options_t{} },
+		{ http_method_get(), "/api/v2/words/:w(\\bw\\w*)", options_t{} },
+		{ http_method_get(), "/api/v3-:kind", options_t{} },
+		{ http_method_get(), "/:any", options_t{} },
+		{ http_method_get(), "/static/file.txt", options_t{} },
+		{ http_method_get(), "/:path(.*)", options_t{} },
+	};
+
+	const std::vector< std::string > paths{
+		"", "/", "//", "/api", "/api/v1/users", "/API/V1/USERS", "/api/v1/users/",
+		"/api/v1/users//", "/api/v1/users/42", "/api/v1/users/42/",
+		"/api/v1/users/42/posts/7", "/api/v1/users/42/posts/7/",
+		"/api/v1/users/42/posts/", "/api/v1/users/42/avatar",
+		"/api/v1/users/abc/avatar", "/api/v1/Sensitive/1",
+		"/api/v1/sensitive/1", "/api/v1/strict/", "/api/v1/strict",
+		"/api/v1/prefix", "/api/v1/prefix/more", "/api/v1/prefixmore",
+		"/api/v2/report.pdf", "/api/v2/a.b.c", "/api/v2", "/api/v2/x",
+		"/api/v2/files/a/b/c", "/api/v2/123/y", "/api/v2/words/word",
+		"/api/v2/words/xword", "/api/v3-kind",
+		"/anything", "/anything/else", "/static/file.txt",
+		"/static/file.txt/", "/static/FILE.TXT", "/%7Euser",
+	};
+
+	restinio::router::express_router_t<> linear_router;
+	restinio::router::single_pass_express_router_t single_pass_router;
+
+	match_result_t linear_result;
+	match_result_t single_pass_result;
+
+	fill_router( linear_router, routes, linear_result );
+	fill_router( single_pass_router, routes, single_pass_result );
+
+	for( const auto method : { http_method_get(), http_method_post() } )
+		for( const auto & path : paths )
+		{
+			INFO( "path: '" << path << "', method: " << method.c_str() );
+
+			linear_result = match_result_t{};
+			single_pass_result = match_result_t{};
+
+			const auto linear_status = linear_router(
+					create_fake_request( linear_router, path, method ) );
+			const auto single_pass_status = single_pass_router(
+					create_fake_request( single_pass_router, path, method ) );
+
+			REQUIRE( linear_status == single_pass_status );
+			REQUIRE( linear_result == single_pass_result );
+		}
+}
+
+TEST_CASE( "Many routes" , "[single_pass_express][many_routes]" )
+{
+	using namespace restinio::path2regex;
+
+	std::vector< route_description_t > routes;
+	for( int i = 0; i != 1000; ++i )
+	{
+		const auto n = std::to_string( i );
+		routes.push_back( { http_method_get(),
+				"/api/r" + n + "/:id(\\d+)", options_t{} } );
+		routes.push_back( { http_method_get(),
+				"/api/r" + n + "/:id/items/:item", options_t{} } );
+	}
+
+	restinio::router::single_pass_express_router_t router;
+	match_result_t result;
+	fill_router( router, routes, result );
+
+	for( int i = 0; i < 1000; i += 37 )
+	{
+		const auto n = std::to_string( i );
+		INFO( "route: " << n );
+
+		result = match_result_t{};
+		REQUIRE( request_accepted() == router(
+				create_fake_request( router, "/api/r" + n + "/42" ) ) );
+		REQUIRE( 2 * i == result.m_handler );
+		REQUIRE( result.m_named ==
+				decltype( result.m_named ){ { "id", "42" } } );
+
+		result = match_result_t{};
+		REQUIRE( request_accepted() == router(
+				create_fake_request( router, "/api/r" + n + "/abc/items/7" ) ) );
+		REQUIRE( 2 * i + 1 == result.m_handler );
+		REQUIRE( result.m_named ==
+				decltype( result.m_named ){ { "id", "abc" }, { "item", "7" } } );
+
+		result = match_result_t{};
+		REQUIRE( request_not_handled() == router(
+				create_fake_request( router, "/api/r" + n + "/abc" ) ) );
+		REQUIRE( -1 == result.m_handler );
+	}
+}
+
+TEST_CASE( "Regex set" , "[single_pass_express][regex_set]" )
+{
+	using restinio::router::impl::nfa_regex::regex_t;
+	using restinio::router::impl::nfa_regex::regex_set_t;
+
+	const std::vector< regex_t > regexes{
+		regex_t{ "^/a/(\\d+)$", false },
+		regex_t{ "^/a/([^/]+)$", false },
+		regex_t{ "\\bb", false },
+		regex_t{ "^/A/b$", true },
+		regex_t{ "c", false },
+	};
+
+	const auto indexes_of = []( const regex_set_t & set, string_view_t text ) {
+		regex_set_t::indexes_container_t indexes;
+		REQUIRE( set.match( text, indexes ) );
+		return std::vector< std::uint32_t >{ indexes.begin(), indexes.end() };
+	};
+
+	regex_set_t set;
+	for( const auto & r : regexes )
+		set.add( r );
+
+	REQUIRE( 5u == set.size() );
+
+	using v = std::vector< std::uint32_t >;
+
+	// Regexes with `\b` are always reported.
+	REQUIRE( v{ 0u, 1u, 2u } == indexes_of( set, "/a/42" ) );
+	REQUIRE( v{ 1u, 2u } == indexes_of( set, "/a/x" ) );
+	REQUIRE( v{ 1u, 2u, 3u } == indexes_of( set, "/a/B" ) );
+	REQUIRE( v{ 1u, 2u, 4u } == indexes_of( set, "/a/c" ) );
+	REQUIRE( v{ 2u, 4u } == indexes_of( set, "/abc" ) );
+	REQUIRE( v{ 2u } == indexes_of( set, "" ) );
+
+	// The limit of states is reached.
+	regex_set_t small_set{ 3u };
+	for( const auto & r : regexes )
+		small_set.add( r );
+
+	regex_set_t::indexes_container_t indexes;
+	REQUIRE_FALSE( small_set.match( "/a/42", indexes ) );
+	REQUIRE_FALSE( small_set.match( "/a/42", indexes ) );
+	REQUIRE_FALSE( small_set.match( "/b", indexes ) );
+
+	// The saturated DFA still handles texts with known transitions.
+	REQUIRE( v{ 2u } == indexes_of( small_set, "" ) );
+}
@@ -14,6 +14,9 @@
 #include <test/common/utest_logger.hpp>
 #include <test/common/pub.hpp>
 
+#include <mutex>
+#include <set>
+
 using namespace restinio::tests;
 
 // The first request can be refused because it can be issued when server
@@ -454,3 +457,188 @@ TEST_CASE( "run_async with automatic stop/wait" , "[run_async]" )
 	REQUIRE( "" != endpoint_value );
 }
 
+
+TEST_CASE( "sharded runner with one shard" , "[sharded_on_pool_runner]" )
+{
+	std::string endpoint_value;
+
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::single_thread_traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	random_port_getter_t port_getter;
+
+	restinio::sharded_on_pool_runner_t< http_server_t > runner{
+		1,
+		[&endpoint_value, &port_getter]( std::size_t, auto & settings ){
+			settings
+				.port( 0 )
+				.address( default_ip_addr() )
+				.acceptor_post_bind_hook( port_getter.as_post_bind_hook() )
+				.request_handler(
+					[&endpoint_value]( auto req ){
+						endpoint_value = fmt::format(
+								RESTINIO_FMT_FORMAT_STRING( "{}" ),
+								restinio::fmtlib_tools::streamed(
+										req->remote_endpoint() ) );
+
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header_date_field()
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body(
+								restinio::const_buffer( req->header().method().c_str() ) )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	REQUIRE( 1u == runner.shards_count() );
+
+	std::promise<void> started;
+	runner.start(
+			[&started]() noexcept { started.set_value(); },
+			[&started]( std::exception_ptr ex ) noexcept {
+				started.set_exception( std::move(ex) );
+			} );
+	REQUIRE_NOTHROW( started.get_future().get() );
+
+	std::string response;
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	REQUIRE_NOTHROW( response = repeat_request(
+			request_str,
+			default_ip_addr(),
+			port_getter.port() ) );
+
+	REQUIRE_THAT( response, Catch::Matchers::EndsWith( "GET" ) );
+
+	runner.stop();
+	runner.wait();
+
+	REQUIRE( "" != endpoint_value );
+}
+
+#if defined(SO_REUSEPORT)
+
+TEST_CASE( "sharded runner with several shards" , "[sharded_on_pool_runner]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::single_thread_traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	// Every shard should be bound to the same port, so a free port
+	// is detected before the start of shards.
+	const std::uint16_t port = [] {
+		restinio::asio_ns::io_context ioctx;
+		restinio::asio_ns::ip::tcp::acceptor acceptor{
+				ioctx,
+				restinio::asio_ns::ip::tcp::endpoint{
+						restinio::asio_ns::ip::make_address( default_ip_addr() ),
+						0u }
+			};
+		return acceptor.local_endpoint().port();
+	}();
+
+	std::mutex lock;
+	std::set< std::thread::id > handler_threads;
+	std::set< std::size_t > handler_shards;
+
+	restinio::sharded_on_pool_runner_t< http_server_t > runner{
+		4,
+		[&]( std::size_t shard_index, auto & settings ){
+			settings
+				.port( port )
+				.address( default_ip_addr() )
+				.request_handler(
+					[&, shard_index]( auto req ){
+						{
+							std::lock_guard< std::mutex > l{ lock };
+							handler_threads.insert( std::this_thread::get_id() );
+							handler_shards.insert( shard_index );
+						}
+
+						req->create_response()
+							.append_header( "Server", "RESTinio utest server" )
+							.append_header( "Content-Type", "text/plain; charset=utf-8" )
+							.set_body(
+								restinio::const_buffer( req->header().method().c_str() ) )
+							.done();
+
+						return restinio::request_accepted();
+					} );
+		} };
+
+	REQUIRE( 4u == runner.shards_count() );
+
+	std::promise<void> started;
+	runner.start(
+			[&started]() noexcept { started.set_value(); },
+			[&started]( std::exception_ptr ex ) noexcept {
+				started.set_exception( std::move(ex) );
+			} );
+	REQUIRE_NOTHROW( started.get_future().get() );
+
+	const char * request_str =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1\r\n"
+		"User-Agent: unit-test\r\n"
+		"Accept: */*\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	for( int i = 0; i != 32; ++i )
+	{
+		std::string response;
+		REQUIRE_NOTHROW( response = repeat_request(
+				request_str,
+				default_ip_addr(),
+				port ) );
+
+		REQUIRE_THAT( response, Catch::Matchers::EndsWith( "GET" ) );
+	}
+
+	runner.stop();
+	runner.wait();
+
+	// Every shard is served by its own thread.
+	REQUIRE( !handler_shards.empty() );
+	REQUIRE( handler_shards.size() == handler_threads.size() );
+}
+
+TEST_CASE( "sharded runner and port 0" , "[sharded_on_pool_runner]" )
+{
+	using http_server_t =
+		restinio::http_server_t<
+			restinio::single_thread_traits_t<
+				restinio::asio_timer_manager_t,
+				utest_logger_t > >;
+
+	using runner_t = restinio::sharded_on_pool_runner_t< http_server_t >;
+
+	REQUIRE_THROWS_AS(
+		runner_t(
+			2,
+			[]( std::size_t, auto & settings ){
+				settings
+					.port( 0 )
+					.address( default_ip_addr() )
+					.request_handler( []( auto ){
+							return restinio::request_rejected();
+						} );
+			} ),
+		restinio::exception_t );
+}
+
+#endif
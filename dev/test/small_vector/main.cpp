@@ -0,0 +1,153 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for small_vector_t.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/utils/small_vector.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace restinio::utils;
+
+namespace
+{
+
+template< typename Container >
+std::vector< std::string >
+to_std_vector( const Container & c )
+{
+	return std::vector< std::string >( c.begin(), c.end() );
+}
+
+} /* namespace anonymous */
+
+TEST_CASE( "Inline storage" , "[small_vector][inline]" )
+{
+	small_vector_t< std::string, 3 > v;
+
+	REQUIRE( v.empty() );
+	REQUIRE( v.is_inline() );
+	REQUIRE( 3u == v.capacity() );
+
+	v.emplace_back( "a" );
+	v.push_back( std::string( 64, 'b' ) );
+	v.emplace_back( 2u, 'c' );
+
+	REQUIRE( 3u == v.size() );
+	REQUIRE( v.is_inline() );
+	REQUIRE( "a" == v.front() );
+	REQUIRE( "cc" == v.back() );
+	REQUIRE( std::string( 64, 'b' ) == v[ 1u ] );
+	REQUIRE( "cc" == v.at( 2u ) );
+	REQUIRE_THROWS_AS( v.at( 3u ), std::out_of_range );
+
+	v.pop_back();
+	REQUIRE( 2u == v.size() );
+
+	v.clear();
+	REQUIRE( v.empty() );
+	REQUIRE( v.is_inline() );
+}
+
+TEST_CASE( "Growth" , "[small_vector][grow]" )
+{
+	small_vector_t< std::string, 2 > v;
+
+	for( int i = 0; i != 10; ++i )
+		v.emplace_back( std::to_string( i ) );
+
+	REQUIRE_FALSE( v.is_inline() );
+	REQUIRE( 10u == v.size() );
+	REQUIRE( v.capacity() >= 10u );
+	for( int i = 0; i != 10; ++i )
+		REQUIRE( std::to_string( i ) == v[ static_cast< std::size_t >( i ) ] );
+
+	small_vector_t< std::string, 2 > reserved;
+	reserved.reserve( 5u );
+	REQUIRE_FALSE( reserved.is_inline() );
+	REQUIRE( 5u == reserved.capacity() );
+	REQUIRE( reserved.empty() );
+}
+
+TEST_CASE( "Move" , "[small_vector][move]" )
+{
+	using vector_t = small_vector_t< std::unique_ptr< int >, 2 >;
+
+	{
+		vector_t v;
+		v.emplace_back( std::make_unique< int >( 1 ) );
+
+		vector_t v2{ std::move( v ) };
+		REQUIRE( v.empty() );
+		REQUIRE( 1u == v2.size() );
+		REQUIRE( 1 == *v2[ 0u ] );
+		REQUIRE( v2.is_inline() );
+	}
+
+	{
+		vector_t v;
+		for( int i = 0; i != 4; ++i )
+			v.emplace_back( std::make_unique< int >( i ) );
+		const auto * data = v.data();
+
+		vector_t v2;
+		v2.emplace_back( std::make_unique< int >( 42 ) );
+		v2 = std::move( v );
+		REQUIRE( v.empty() );
+		REQUIRE( v.is_inline() );
+		REQUIRE( 4u == v2.size() );
+		REQUIRE( data == v2.data() );
+		REQUIRE( 3 == *v2.back() );
+	}
+
+	{
+		vector_t a;
+		a.emplace_back( std::make_unique< int >( 1 ) );
+		vector_t b;
+		for( int i = 0; i != 3; ++i )
+			b.emplace_back( std::make_unique< int >( 10 + i ) );
+
+		swap( a, b );
+		REQUIRE( 3u == a.size() );
+		REQUIRE( 10 == *a.front() );
+		REQUIRE( 1u == b.size() );
+		REQUIRE( 1 == *b.front() );
+	}
+}
+
+TEST_CASE( "Insert, erase and resize" , "[small_vector][modifiers]" )
+{
+	small_vector_t< std::string, 4 > v{ "a", "b", "c" };
+
+	v.insert( v.begin() + 1, "x" );
+	REQUIRE( to_std_vector( v ) ==
+			std::vector< std::string >{ "a", "x", "b", "c" } );
+
+	v.insert( v.end(), "y" );
+	REQUIRE( to_std_vector( v ) ==
+			std::vector< std::string >{ "a", "x", "b", "c", "y" } );
+
+	v.erase( v.begin(), v.begin() + 2 );
+	REQUIRE( to_std_vector( v ) ==
+			std::vector< std::string >{ "b", "c", "y" } );
+
+	v.erase( v.begin() + 1 );
+	REQUIRE( to_std_vector( v ) == std::vector< std::string >{ "b", "y" } );
+
+	v.resize( 4u );
+	REQUIRE( to_std_vector( v ) ==
+			std::vector< std::string >{ "b", "y", "", "" } );
+
+	v.resize( 1u );
+	REQUIRE( to_std_vector( v ) == std::vector< std::string >{ "b" } );
+
+	const auto copy = v;
+	REQUIRE( to_std_vector( copy ) == std::vector< std::string >{ "b" } );
+}
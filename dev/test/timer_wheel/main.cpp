@@ -0,0 +1,253 @@
+/*
+	restinio
+*/
+
+/*!
+	Tests for timer wheel and timer wheel manager.
+*/
+
+#include <catch2/catch_all.hpp>
+
+#include <restinio/timer_wheel_manager.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace restinio;
+using namespace restinio::impl;
+
+namespace
+{
+
+struct test_node_t final : public timer_wheel_node_t
+{
+	int m_id;
+
+	explicit test_node_t( int id ) : m_id{ id } {}
+};
+
+std::vector< std::pair< int, std::uint64_t > >
+advance_and_collect( timer_wheel_t & wheel, std::uint64_t target )
+{
+	std::vector< std::pair< int, std::uint64_t > > result;
+	wheel.advance( target,
+		[&]( timer_wheel_node_t & node ) noexcept {
+			result.emplace_back(
+					static_cast< test_node_t & >( node ).m_id,
+					wheel.current_tick() );
+		} );
+
+	return result;
+}
+
+class test_ctx_t final : public tcp_connection_ctx_base_t
+{
+	public:
+		test_ctx_t() : tcp_connection_ctx_base_t{ 1u } {}
+
+		void
+		check_timeout( std::shared_ptr< tcp_connection_ctx_base_t > & ) override
+		{
+			++m_checks;
+		}
+
+		std::atomic< int > m_checks{ 0 };
+};
+
+} /* anonymous namespace */
+
+TEST_CASE( "Timers expire at their ticks" , "[timer_wheel][expiration]" )
+{
+	timer_wheel_t wheel;
+
+	test_node_t n1{ 1 }, n2{ 2 }, n3{ 3 }, n4{ 4 };
+	wheel.schedule( n1, 5u );
+	wheel.schedule( n2, 63u );
+	wheel.schedule( n3, 64u );
+	wheel.schedule( n4, 5000u );
+
+	REQUIRE( 4u == wheel.size() );
+
+	REQUIRE( advance_and_collect( wheel, 4u ).empty() );
+
+	using expected_t = std::vector< std::pair< int, std::uint64_t > >;
+	REQUIRE( expected_t{ { 1, 5u } } == advance_and_collect( wheel, 10u ) );
+	REQUIRE( expected_t{ { 2, 63u }, { 3, 64u } } ==
+			advance_and_collect( wheel, 100u ) );
+	REQUIRE( expected_t{ { 4, 5000u } } ==
+			advance_and_collect( wheel, 10000u ) );
+
+	REQUIRE( wheel.empty() );
+	REQUIRE( !n4.is_linked() );
+}
+
+TEST_CASE( "Cancel and reschedule" , "[timer_wheel][cancel]" )
+{
+	timer_wheel_t wheel;
+
+	test_node_t n1{ 1 }, n2{ 2 };
+	wheel.schedule( n1, 10u );
+	wheel.schedule( n2, 300u );
+
+	wheel.cancel( n1 );
+	REQUIRE( !n1.is_linked() );
+	REQUIRE( 1u == wheel.size() );
+
+	// Cancel of not linked node is a no-op.
+	wheel.cancel( n1 );
+	REQUIRE( 1u == wheel.size() );
+
+	wheel.schedule( n2, 20u );
+	REQUIRE( 1u == wheel.size() );
+
+	using expected_t = std::vector< std::pair< int, std::uint64_t > >;
+	REQUIRE( expected_t{ { 2, 20u } } == advance_and_collect( wheel, 1000u ) );
+}
+
+TEST_CASE( "Expired in the past" , "[timer_wheel][past]" )
+{
+	timer_wheel_t wheel{ 100u };
+
+	test_node_t n1{ 1 };
+	wheel.schedule( n1, 50u );
+	REQUIRE( 101u == n1.expires_at() );
+	REQUIRE( 101u == wheel.next_tick_to_advance() );
+}
+
+TEST_CASE( "Many timers on all levels" , "[timer_wheel][levels]" )
+{
+	timer_wheel_t wheel{ 12345u };
+
+	std::vector< std::unique_ptr< test_node_t > > nodes;
+	std::uint64_t expires_at = wheel.current_tick();
+	for( int i = 0; i != 2000; ++i )
+	{
+		expires_at += static_cast< std::uint64_t >( 1 + (i * 7919) % 9973 );
+		nodes.push_back( std::make_unique< test_node_t >( i ) );
+		wheel.schedule( *nodes.back(), expires_at );
+	}
+
+	// A timer beyond the span of the wheel.
+	test_node_t far{ -1 };
+	const std::uint64_t far_expires_at =
+			wheel.current_tick() + timer_wheel_t::max_span + 1000u;
+	wheel.schedule( far, far_expires_at );
+
+	std::vector< std::pair< int, std::uint64_t > > expired;
+	while( !wheel.empty() )
+	{
+		auto part = advance_and_collect( wheel, wheel.next_tick_to_advance() );
+		expired.insert( expired.end(), part.begin(), part.end() );
+	}
+
+	REQUIRE( 2001u == expired.size() );
+
+	int expected_id = 0;
+	for( std::size_t i = 0u; i != 2000u; ++i )
+	{
+		REQUIRE( expected_id == expired[ i ].first );
+		REQUIRE( nodes[ i ]->expires_at() == expired[ i ].second );
+		++expected_id;
+	}
+
+	REQUIRE( -1 == expired.back().first );
+	REQUIRE( far_expires_at == expired.back().second );
+}
+
+TEST_CASE( "Timer wheel manager" , "[timer_wheel_manager]" )
+{
+	asio_ns::io_context io_context;
+
+	auto manager = timer_wheel_manager_t::factory_t{
+			std::chrono::milliseconds{ 20 },
+			std::chrono::milliseconds{ 5 } }.create( io_context );
+	manager->start();
+
+	auto ctx1 = std::make_shared< test_ctx_t >();
+	auto ctx2 = std::make_shared< test_ctx_t >();
+
+	auto guard1 = manager->create_timer_guard();
+	auto guard2 = manager->create_timer_guard();
+
+	const auto started_at = std::chrono::steady_clock::now();
+	guard1.schedule( ctx1 );
+	guard2.schedule( ctx2 );
+	guard2.cancel();
+
+	io_context.run_for( std::chrono::milliseconds{ 200 } );
+
+	REQUIRE( 1 == ctx1->m_checks );
+	REQUIRE( 0 == ctx2->m_checks );
+	REQUIRE( std::chrono::milliseconds{ 200 } >
+			std::chrono::steady_clock::now() - started_at );
+
+	// The wheel is empty, so there is no more work for io_context.
+	REQUIRE( io_context.stopped() );
+
+	// Scheduling after idle.
+	io_context.restart();
+	guard1.schedule( ctx1 );
+	io_context.run_for( std::chrono::milliseconds{ 200 } );
+	REQUIRE( 2 == ctx1->m_checks );
+
+	// Scheduling at deadlines. The earlier deadline should fire first.
+	io_context.restart();
+	const auto now = std::chrono::steady_clock::now();
+	guard1.schedule_at( ctx1, now + std::chrono::milliseconds{ 60 } );
+	guard2.schedule_at( ctx2, now + std::chrono::milliseconds{ 10 } );
+	io_context.run_for( std::chrono::milliseconds{ 35 } );
+	REQUIRE( 2 == ctx1->m_checks );
+	REQUIRE( 1 == ctx2->m_checks );
+	REQUIRE( std::chrono::steady_clock::now() - now >=
+			std::chrono::milliseconds{ 10 } );
+
+	io_context.run_for( std::chrono::milliseconds{ 200 } );
+	REQUIRE( 3 == ctx1->m_checks );
+
+	manager->stop();
+}
+
+TEST_CASE( "Timer wheel manager on several threads" , "[timer_wheel_manager][mt]" )
+{
+	asio_ns::io_context io_context;
+
+	auto manager = timer_wheel_manager_t::factory_t{
+			std::chrono::milliseconds{ 10 },
+			std::chrono::milliseconds{ 2 } }.create( io_context );
+	manager->start();
+
+	constexpr int contexts_count = 64;
+	std::vector< std::shared_ptr< test_ctx_t > > contexts;
+	std::vector< std::unique_ptr< timer_wheel_manager_t::timer_guard_t > > guards;
+	for( int i = 0; i != contexts_count; ++i )
+	{
+		contexts.push_back( std::make_shared< test_ctx_t >() );
+		guards.push_back(
+				std::make_unique< timer_wheel_manager_t::timer_guard_t >(
+						manager ) );
+	}
+
+	auto work = asio_ns::make_work_guard( io_context );
+	std::vector< std::thread > threads;
+	for( int i = 0; i != 4; ++i )
+		threads.emplace_back( [&]{ io_context.run(); } );
+
+	for( int round = 0; round != 5; ++round )
+	{
+		for( int i = 0; i != contexts_count; ++i )
+		{
+			guards[ static_cast< std::size_t >( i ) ]->schedule(
+					contexts[ static_cast< std::size_t >( i ) ] );
+		}
+		std::this_thread::sleep_for( std::chrono::milliseconds{ 30 } );
+	}
+
+	manager->stop();
+	work.reset();
+	io_context.stop();
+	for( auto & t : threads )
+		t.join();
+
+	for( auto & ctx : contexts )
+		REQUIRE( 5 == ctx->m_checks );
+}
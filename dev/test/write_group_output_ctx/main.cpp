@@ -18,6 +18,7 @@ using namespace restinio::impl;
 using none_write_operation_t = write_group_output_ctx_t::none_write_operation_t;
 using trivial_write_operation_t = write_group_output_ctx_t::trivial_write_operation_t;
 using file_write_operation_t = write_group_output_ctx_t::file_write_operation_t;
+using generator_write_operation_t = write_group_output_ctx_t::generator_write_operation_t;
 
 std::string
 make_string( const asio_ns::const_buffer & buf )
@@ -271,6 +272,45 @@ TEST_CASE( "write_group_output_ctx_t simple" , "[write_group_output_ctx_t][trivi
 	}
 }
 
+TEST_CASE( "write_group_output_ctx_t partial write" , "[write_group_output_ctx_t][trivial][consume]" )
+{
+	write_group_output_ctx_t wg_output{};
+
+	wg_output.start_next_write_group(
+		write_group_t{
+			make_buffers( { "0123", "45", "6789" } ) } );
+
+	auto wo = wg_output.extract_next_write_operation();
+	REQUIRE( std::holds_alternative< trivial_write_operation_t >( wo ) );
+
+	auto & op = std::get< trivial_write_operation_t >( wo );
+	REQUIRE( 10u == op.size() );
+
+	op.consume( 0u );
+	REQUIRE( 10u == op.size() );
+	REQUIRE( 3u == op.get_trivial_bufs().size() );
+
+	op.consume( 2u );
+	REQUIRE( 8u == op.size() );
+	REQUIRE( 3u == op.get_trivial_bufs().size() );
+	REQUIRE( concat_bufs( op.get_trivial_bufs() ) == "23456789" );
+
+	op.consume( 4u );
+	REQUIRE( 4u == op.size() );
+	REQUIRE( 1u == op.get_trivial_bufs().size() );
+	REQUIRE( concat_bufs( op.get_trivial_bufs() ) == "6789" );
+
+	op.consume( 3u );
+	REQUIRE( 1u == op.size() );
+	REQUIRE( concat_bufs( op.get_trivial_bufs() ) == "9" );
+
+	REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+	REQUIRE( std::holds_alternative< none_write_operation_t >( wo ) );
+
+	REQUIRE_NOTHROW( wg_output.finish_write_group() );
+	REQUIRE_FALSE( wg_output.transmitting() );
+}
+
 TEST_CASE( "write_group_output_ctx_t simple sf" , "[write_group_output_ctx_t][sendfile]" )
 {
 	{
@@ -456,6 +496,89 @@ TEST_CASE( "write_group_output_ctx_t mixed" , "[write_group_output_ctx_t][mix][t
 	}
 }
 
+TEST_CASE( "write_group_output_ctx_t body generator" , "[write_group_output_ctx_t][generator]" )
+{
+	write_group_output_ctx_t wg_output{};
+
+	// Generates bytes 'a'..'z' cyclically, 7 bytes at a time.
+	std::size_t generated{ 0u };
+	writable_items_container_t items;
+	items.emplace_back( std::string{ "HEAD" } );
+	items.emplace_back( restinio::body_generator(
+			20u,
+			[&generated]( char * buf, std::size_t capacity ) {
+				const auto n = std::min< std::size_t >( capacity, 7u );
+				for( std::size_t i = 0u; i != n; ++i, ++generated )
+					buf[ i ] = static_cast< char >( 'a' + generated % 26u );
+				return n;
+			} ) );
+	items.emplace_back( std::string{ "TAIL" } );
+
+	wg_output.start_next_write_group( write_group_t{ std::move( items ) } );
+
+	// Groups with generators aren't coalesced.
+	REQUIRE( 0u == wg_output.coalescing_capacity().m_items );
+
+	write_group_output_ctx_t::solid_write_operation_variant_t wo{};
+
+	REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+	REQUIRE( std::holds_alternative< trivial_write_operation_t >( wo ) );
+	REQUIRE( concat_bufs(
+			std::get< trivial_write_operation_t >( wo ).get_trivial_bufs() ) ==
+				"HEAD" );
+
+	REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+	REQUIRE( std::holds_alternative< generator_write_operation_t >( wo ) );
+
+	auto gen_op = std::get< generator_write_operation_t >( wo );
+	REQUIRE( 20u == gen_op.size() );
+
+	std::string body;
+	const char * buffer_data{ nullptr };
+	for( auto piece = gen_op.next_piece();
+			0u != piece.size();
+			piece = gen_op.next_piece() )
+	{
+		// The same buffer is used for every piece.
+		if( !buffer_data )
+			buffer_data = static_cast< const char * >( piece.data() );
+		REQUIRE( buffer_data == piece.data() );
+
+		body += make_string( piece );
+	}
+	REQUIRE( "abcdefghijklmnopqrst" == body );
+	REQUIRE( 0u == gen_op.remaining() );
+
+	REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+	REQUIRE( std::holds_alternative< trivial_write_operation_t >( wo ) );
+	REQUIRE( concat_bufs(
+			std::get< trivial_write_operation_t >( wo ).get_trivial_bufs() ) ==
+				"TAIL" );
+
+	REQUIRE_NOTHROW( wo = wg_output.extract_next_write_operation() );
+	REQUIRE( std::holds_alternative< none_write_operation_t >( wo ) );
+
+	REQUIRE_NOTHROW( wg_output.finish_write_group() );
+	REQUIRE_FALSE( wg_output.transmitting() );
+}
+
+TEST_CASE( "body generator produces less data than declared" , "[generator]" )
+{
+	auto generator = restinio::body_generator(
+			10u,
+			[calls = 0]( char * buf, std::size_t ) mutable -> std::size_t {
+				if( calls++ )
+					return 0u;
+				buf[ 0 ] = 'x';
+				return 1u;
+			} );
+
+	char buf[ 16 ];
+	REQUIRE( 1u == generator.next( buf, sizeof( buf ) ) );
+	REQUIRE( 9u == generator.remaining() );
+	REQUIRE_THROWS_AS( generator.next( buf, sizeof( buf ) ), restinio::exception_t );
+}
+
 TEST_CASE( "write_group_output_ctx_t two groups" , "[write_group_output_ctx_t][trivial][restart]" )
 {
 	{
@@ -524,3 +647,99 @@ TEST_CASE( "write_group_output_ctx_t two groups" , "[write_group_output_ctx_t][t
 		REQUIRE_FALSE( wg_output.transmitting() );
 	}
 }
+
+TEST_CASE( "write_group_output_ctx_t coalesced groups" , "[write_group_output_ctx_t][coalescing]" )
+{
+	std::vector< std::string > notifications;
+	const auto make_group = [&]( std::vector< std::string > bufs, std::string name ) {
+			write_group_t wg{ make_buffers( std::move( bufs ) ) };
+			wg.after_write_notificator(
+				[&notifications, name]( const auto & ec ) {
+					notifications.push_back( name + (ec ? ":error" : ":ok") );
+				} );
+			return wg;
+		};
+
+	SECTION( "successful write" )
+	{
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group( make_group( { "A", "B" }, "first" ) );
+
+		auto capacity = wg_output.coalescing_capacity();
+		REQUIRE( 0u != capacity.m_items );
+		REQUIRE( write_group_output_ctx_t::max_coalesced_bytes - 2u ==
+				capacity.m_bytes );
+
+		wg_output.append_write_group( make_group( { "C" }, "second" ) );
+		wg_output.append_write_group( make_group( { "D", "E" }, "third" ) );
+		REQUIRE( 2u == wg_output.coalesced_groups_count() );
+		REQUIRE( capacity.m_items - 3u ==
+				wg_output.coalescing_capacity().m_items );
+		REQUIRE( capacity.m_bytes - 3u ==
+				wg_output.coalescing_capacity().m_bytes );
+
+		auto wo = wg_output.extract_next_write_operation();
+		REQUIRE( std::holds_alternative< trivial_write_operation_t >( wo ) );
+		REQUIRE( 5u == std::get< trivial_write_operation_t >( wo ).size() );
+		REQUIRE(
+			concat_bufs(
+				std::get< trivial_write_operation_t >( wo )
+					.get_trivial_bufs() ) == "ABCDE" );
+
+		wo = wg_output.extract_next_write_operation();
+		REQUIRE( std::holds_alternative< none_write_operation_t >( wo ) );
+
+		REQUIRE_NOTHROW( wg_output.finish_write_group() );
+		REQUIRE_FALSE( wg_output.transmitting() );
+		REQUIRE( 0u == wg_output.coalesced_groups_count() );
+
+		REQUIRE( std::vector< std::string >{
+					"first:ok", "second:ok", "third:ok" } == notifications );
+	}
+
+	SECTION( "failed write" )
+	{
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group( make_group( { "A" }, "first" ) );
+		wg_output.append_write_group( make_group( { "B" }, "second" ) );
+
+		auto wo = wg_output.extract_next_write_operation();
+		REQUIRE( std::holds_alternative< trivial_write_operation_t >( wo ) );
+
+		REQUIRE_NOTHROW( wg_output.fail_write_group(
+				make_error_code( asio_ns::error::broken_pipe ) ) );
+		REQUIRE_FALSE( wg_output.transmitting() );
+
+		REQUIRE( std::vector< std::string >{
+					"first:error", "second:error" } == notifications );
+	}
+
+	SECTION( "no coalescing for sendfile" )
+	{
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group(
+			write_group_t{
+				make_buffers(
+					make_buffers( { "HEADER" } ),
+					make_buffers( restinio::sendfile(
+						restinio::null_file_descriptor() /* fake not real */,
+						restinio::file_meta_t{
+								1024, std::chrono::system_clock::now() } ) ) ) } );
+
+		REQUIRE( 0u == wg_output.coalescing_capacity().m_items );
+	}
+
+	SECTION( "no coalescing for big group" )
+	{
+		write_group_output_ctx_t wg_output{};
+
+		wg_output.start_next_write_group( make_group(
+				{ std::string( write_group_output_ctx_t::max_coalesced_bytes + 1u, 'x' ) },
+				"big" ) );
+
+		REQUIRE( 0u == wg_output.coalescing_capacity().m_items );
+	}
+}